@@ -0,0 +1,262 @@
+#include <coroutine>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <optional>
+#include <unordered_map>
+#include <exception>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include <utility>
+#include "mat.hpp"
+#include "pool.hpp"
+
+#ifndef ASYNC_HPP
+#define ASYNC_HPP
+
+// 异常：任务在开始执行前被取消
+struct OperationCancelled final : std::runtime_error
+{
+    OperationCancelled() : std::runtime_error("Operation was cancelled.") {}
+};
+
+namespace Detail
+{
+    // 不超过该乘加次数的任务走合批路径
+    inline constexpr std::size_t AsyncBatchThreshold = 4096;
+
+    // 异步任务共享状态
+    template <typename T>
+    struct AsyncState
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::optional<T> value;
+        std::exception_ptr error;
+        std::coroutine_handle<> continuation;
+        std::atomic<bool> cancelled = false;
+        bool done = false;
+
+        template <typename Fn>
+        void Run(Fn &fn)
+        {
+            std::optional<T> result;
+            std::exception_ptr err;
+            if (cancelled.load(std::memory_order_relaxed))
+            {
+                err = std::make_exception_ptr(OperationCancelled{});
+            }
+            else
+            {
+                try
+                {
+                    result.emplace(fn());
+                }
+                catch (...)
+                {
+                    err = std::current_exception();
+                }
+            }
+
+            std::coroutine_handle<> next;
+            {
+                std::lock_guard lock(mutex);
+                value = std::move(result);
+                error = err;
+                done = true;
+                next = std::exchange(continuation, nullptr);
+            }
+            cv.notify_all();
+            // 协程在完成任务的工作线程上恢复
+            if (next)
+                next.resume();
+        }
+    };
+
+    // 合批任务
+    template <typename T, typename Fn>
+    struct BatchedJob
+    {
+        Fn fn;
+        std::shared_ptr<AsyncState<T>> state;
+
+        void operator()() { state->Run(fn); }
+    };
+
+    // 合批器：同类型小任务在一次池任务中连续计算；待处理批次按线程池分开，
+    // 保证任务只在调用者指定的池上执行
+    template <typename Job>
+    struct Batcher final
+    {
+        std::mutex mutex;
+        std::unordered_map<ThreadPool *, std::vector<Job>> pending;
+
+        static Batcher &Instance()
+        {
+            static Batcher batcher;
+            return batcher;
+        }
+
+        void Push(Job job, ThreadPool &pool)
+        {
+            bool first;
+            {
+                std::lock_guard lock(mutex);
+                auto &jobs = pending[&pool];
+                first = jobs.empty();
+                jobs.push_back(std::move(job));
+            }
+            // 只有打开新批次的请求负责投递一次冲刷
+            if (first)
+                pool.Submit([this, target = &pool]
+                            { Flush(target); });
+        }
+
+        void Flush(ThreadPool *pool)
+        {
+            std::vector<Job> jobs;
+            {
+                std::lock_guard lock(mutex);
+                auto it = pending.find(pool);
+                if (it == pending.end())
+                    return;
+                jobs = std::move(it->second);
+                pending.erase(it);
+            }
+            for (auto &job : jobs)
+                job();
+        }
+    };
+}
+
+// 异步结果：可阻塞 get()，也可 co_await；析构即视为放弃并取消
+template <typename T>
+struct AsyncResult final
+{
+private:
+    std::shared_ptr<Detail::AsyncState<T>> _state;
+
+public:
+    // 构造
+    explicit AsyncResult(std::shared_ptr<Detail::AsyncState<T>> state) : _state(std::move(state)) {}
+
+    AsyncResult(const AsyncResult &) = delete;
+
+    AsyncResult(AsyncResult &&other) = default;
+
+    // 析构
+    ~AsyncResult() { Cancel(); }
+
+    // 赋值
+    AsyncResult &operator=(const AsyncResult &) = delete;
+
+    AsyncResult &operator=(AsyncResult &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Cancel();
+            _state = std::move(other._state);
+        }
+        return *this;
+    }
+
+    // 取消：尚未开始的任务将以 OperationCancelled 结束，已在执行的任务不受影响
+    void Cancel() noexcept
+    {
+        if (_state)
+            _state->cancelled.store(true, std::memory_order_relaxed);
+    }
+
+    // 查询方法
+    bool ready() const
+    {
+        std::lock_guard lock(_state->mutex);
+        return _state->done;
+    }
+
+    void wait() const
+    {
+        std::unique_lock lock(_state->mutex);
+        _state->cv.wait(lock, [this]
+                        { return _state->done; });
+    }
+
+    // 取值：只能调用一次
+    T get()
+    {
+        wait();
+        if (_state->error)
+            std::rethrow_exception(_state->error);
+        return std::move(*_state->value);
+    }
+
+    // 协程支持
+    bool await_ready() const { return ready(); }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        std::lock_guard lock(_state->mutex);
+        if (_state->done)
+            return false;
+        _state->continuation = handle;
+        return true;
+    }
+
+    T await_resume() { return get(); }
+};
+
+// 通用异步提交
+template <typename Fn>
+auto RunAsync(ThreadPool &pool, Fn fn)
+{
+    using ResultT = std::invoke_result_t<Fn &>;
+    auto state = std::make_shared<Detail::AsyncState<ResultT>>();
+    pool.Submit([fn = std::move(fn), state]() mutable
+                { state->Run(fn); });
+    return AsyncResult<ResultT>(state);
+}
+
+// 异步矩阵乘法
+template <Detail::NumericMat T, Detail::NumericMat U, size_t Row, size_t Col, size_t OtherCol>
+auto MultiplyAsync(const Mat<T, Row, Col> &lhs, const Mat<U, Col, OtherCol> &rhs, ThreadPool &pool = ThreadPool::Default())
+{
+    auto fn = [lhs, rhs]
+    { return lhs * rhs; };
+    using ResultT = decltype(fn());
+
+    if constexpr (Row * Col * OtherCol <= Detail::AsyncBatchThreshold)
+    {
+        auto state = std::make_shared<Detail::AsyncState<ResultT>>();
+        using Job = Detail::BatchedJob<ResultT, decltype(fn)>;
+        Detail::Batcher<Job>::Instance().Push(Job{std::move(fn), state}, pool);
+        return AsyncResult<ResultT>(state);
+    }
+    else
+    {
+        return RunAsync(pool, std::move(fn));
+    }
+}
+
+// 异步逆矩阵
+template <Detail::NumericMat T, size_t Size>
+auto InverseAsync(const Mat<T, Size, Size> &mat, ThreadPool &pool = ThreadPool::Default())
+{
+    auto fn = [mat]
+    { return Inverse(mat); };
+    using ResultT = decltype(fn());
+
+    if constexpr (Size * Size * Size <= Detail::AsyncBatchThreshold)
+    {
+        auto state = std::make_shared<Detail::AsyncState<ResultT>>();
+        using Job = Detail::BatchedJob<ResultT, decltype(fn)>;
+        Detail::Batcher<Job>::Instance().Push(Job{std::move(fn), state}, pool);
+        return AsyncResult<ResultT>(state);
+    }
+    else
+    {
+        return RunAsync(pool, std::move(fn));
+    }
+}
+
+#endif // ASYNC_HPP
@@ -0,0 +1,426 @@
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "vec.hpp"
+#include "mat.hpp"
+
+#ifndef AUTODIFF_HPP
+#define AUTODIFF_HPP
+
+// 前向模式对偶数：值 + K 个方向导数，导数通道按元素循环便于编译器向量化
+template <std::floating_point T, std::size_t K>
+struct Dual final
+{
+private:
+    // 数据
+    T _value;
+    std::array<T, K> _grad;
+
+public:
+    using dual_type_alias = T;
+
+    // 构造
+    constexpr Dual() : _value(0) { _grad.fill(0); }
+
+    constexpr Dual(T value) : _value(value) { _grad.fill(0); }
+
+    constexpr Dual(T value, const std::array<T, K> &grad) : _value(value), _grad(grad) {}
+
+    // 第 index 个自变量
+    static constexpr Dual Variable(T value, std::size_t index)
+    {
+        Dual result(value);
+        result._grad[index] = 1;
+        return result;
+    }
+
+    // 访问
+    constexpr T value() const noexcept { return _value; }
+
+    constexpr const std::array<T, K> &grad() const noexcept { return _grad; }
+
+    constexpr T grad(std::size_t index) const { return _grad[index]; }
+
+    // 链式法则：f(x) 的值为 value，f'(x) 为 slope
+    constexpr Dual Chain(T value, T slope) const
+    {
+        Dual result(value);
+        for (std::size_t i = 0; i < K; ++i)
+            result._grad[i] = slope * _grad[i];
+        return result;
+    }
+
+    // 运算
+    constexpr friend Dual operator+(const Dual &lhs, const Dual &rhs)
+    {
+        Dual result(lhs._value + rhs._value);
+        for (std::size_t i = 0; i < K; ++i)
+            result._grad[i] = lhs._grad[i] + rhs._grad[i];
+        return result;
+    }
+
+    constexpr friend Dual operator-(const Dual &lhs, const Dual &rhs)
+    {
+        Dual result(lhs._value - rhs._value);
+        for (std::size_t i = 0; i < K; ++i)
+            result._grad[i] = lhs._grad[i] - rhs._grad[i];
+        return result;
+    }
+
+    constexpr friend Dual operator*(const Dual &lhs, const Dual &rhs)
+    {
+        Dual result(lhs._value * rhs._value);
+        for (std::size_t i = 0; i < K; ++i)
+            result._grad[i] = lhs._grad[i] * rhs._value + lhs._value * rhs._grad[i];
+        return result;
+    }
+
+    constexpr friend Dual operator/(const Dual &lhs, const Dual &rhs)
+    {
+        const T inv = static_cast<T>(1) / rhs._value;
+        Dual result(lhs._value * inv);
+        for (std::size_t i = 0; i < K; ++i)
+            result._grad[i] = (lhs._grad[i] - result._value * rhs._grad[i]) * inv;
+        return result;
+    }
+
+    constexpr Dual operator-() const
+    {
+        return Chain(-_value, static_cast<T>(-1));
+    }
+
+    // 复合赋值运算符
+    constexpr Dual &operator+=(const Dual &other) { return *this = *this + other; }
+
+    constexpr Dual &operator-=(const Dual &other) { return *this = *this - other; }
+
+    constexpr Dual &operator*=(const Dual &other) { return *this = *this * other; }
+
+    constexpr Dual &operator/=(const Dual &other) { return *this = *this / other; }
+
+    // 比较操作符：只比较值
+    constexpr friend bool operator==(const Dual &lhs, const Dual &rhs) { return lhs._value == rhs._value; }
+
+    constexpr friend auto operator<=>(const Dual &lhs, const Dual &rhs) { return lhs._value <=> rhs._value; }
+
+    static const std::type_info &type() noexcept { return typeid(Dual<T, K>); }
+
+    static const std::type_info &value_type() noexcept { return typeid(T); }
+};
+
+template <std::floating_point T, std::size_t K>
+struct Detail::IsScalarExtension<Dual<T, K>> : std::true_type
+{
+};
+
+// 初等函数
+template <std::floating_point T, std::size_t K>
+Dual<T, K> sqrt(const Dual<T, K> &x)
+{
+    const T root = std::sqrt(x.value());
+    return x.Chain(root, static_cast<T>(0.5) / root);
+}
+
+template <std::floating_point T, std::size_t K>
+Dual<T, K> abs(const Dual<T, K> &x)
+{
+    return x.value() < 0 ? -x : x;
+}
+
+template <std::floating_point T, std::size_t K>
+Dual<T, K> exp(const Dual<T, K> &x)
+{
+    const T e = std::exp(x.value());
+    return x.Chain(e, e);
+}
+
+template <std::floating_point T, std::size_t K>
+Dual<T, K> log(const Dual<T, K> &x)
+{
+    return x.Chain(std::log(x.value()), static_cast<T>(1) / x.value());
+}
+
+template <std::floating_point T, std::size_t K>
+Dual<T, K> sin(const Dual<T, K> &x)
+{
+    return x.Chain(std::sin(x.value()), std::cos(x.value()));
+}
+
+template <std::floating_point T, std::size_t K>
+Dual<T, K> cos(const Dual<T, K> &x)
+{
+    return x.Chain(std::cos(x.value()), -std::sin(x.value()));
+}
+
+// 输出运算符
+template <std::floating_point T, std::size_t K>
+std::ostream &operator<<(std::ostream &os, const Dual<T, K> &x)
+{
+    os << x.value() << " + (";
+    for (std::size_t i = 0; i < K; ++i)
+    {
+        os << x.grad(i);
+        if (i < K - 1)
+            os << ", ";
+    }
+    os << ")e";
+    return os;
+}
+
+// 把 x 的每个分量设为一个自变量
+template <std::floating_point T, std::size_t N>
+constexpr Vec<Dual<T, N>, N> MakeDual(const Vec<T, N> &x)
+{
+    Vec<Dual<T, N>, N> result;
+    for (std::size_t i = 0; i < N; ++i)
+        result[i] = Dual<T, N>::Variable(x[i], i);
+    return result;
+}
+
+// 前向模式梯度：f 为 Vec<Dual<T, N>, N> -> Dual<T, N>，一次求值得到全部偏导
+template <std::floating_point T, std::size_t N, typename F>
+Vec<T, N> Gradient(F &&f, const Vec<T, N> &x)
+{
+    const Dual<T, N> y = f(MakeDual(x));
+    return Vec<T, N>(y.grad());
+}
+
+// 前向模式雅可比矩阵：f 为 Vec<Dual<T, N>, N> -> Vec<Dual<T, N>, M>
+template <std::floating_point T, std::size_t N, typename F>
+auto Jacobian(F &&f, const Vec<T, N> &x)
+{
+    const auto y = f(MakeDual(x));
+    constexpr std::size_t M = decltype(y)::size();
+    Mat<T, M, N> result;
+    for (std::size_t r = 0; r < M; ++r)
+    {
+        for (std::size_t c = 0; c < N; ++c)
+        {
+            result[r, c] = y[r].grad(c);
+        }
+    }
+    return result;
+}
+
+// 反向模式：每个节点记录至多两个父节点及其局部偏导
+template <std::floating_point T>
+struct Var;
+
+template <std::floating_point T>
+struct Tape final
+{
+private:
+    struct Node
+    {
+        std::size_t parent[2];
+        T partial[2];
+    };
+
+    std::vector<Node> _nodes;
+
+    template <std::floating_point U>
+    friend struct Var;
+
+    std::size_t Push(std::size_t p0, T d0, std::size_t p1, T d1)
+    {
+        _nodes.push_back(Node{{p0, p1}, {d0, d1}});
+        return _nodes.size() - 1;
+    }
+
+public:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    // 构造
+    Tape() = default;
+
+    Tape(const Tape &) = delete;
+
+    Tape &operator=(const Tape &) = delete;
+
+    // 新自变量
+    Var<T> Variable(T value);
+
+    // 反向传播：返回各节点的伴随值，按 Var::index() 取对应偏导
+    std::vector<T> Gradient(const Var<T> &output) const;
+
+    // 清空记录以复用内存
+    void Clear() noexcept { _nodes.clear(); }
+
+    std::size_t size() const noexcept { return _nodes.size(); }
+};
+
+template <std::floating_point T>
+struct Var final
+{
+private:
+    // 数据
+    T _value;
+    Tape<T> *_tape = nullptr;
+    std::size_t _index = Tape<T>::npos;
+
+    friend struct Tape<T>;
+
+    constexpr Var(T value, Tape<T> *tape, std::size_t index) : _value(value), _tape(tape), _index(index) {}
+
+    // 两个操作数都在磁带上时必须属于同一条磁带，否则节点下标无意义
+    static Var Record(T value, const Var &a, T da, const Var &b, T db)
+    {
+        if (a._tape && b._tape && a._tape != b._tape)
+        {
+            throw std::runtime_error("Var operands belong to different tapes.");
+        }
+        Tape<T> *tape = a._tape ? a._tape : b._tape;
+        if (!tape)
+            return Var(value);
+        return Var(value, tape, tape->Push(a._index, da, b._index, db));
+    }
+
+    static Var Record(T value, const Var &a, T da)
+    {
+        if (!a._tape)
+            return Var(value);
+        return Var(value, a._tape, a._tape->Push(a._index, da, Tape<T>::npos, 0));
+    }
+
+public:
+    using var_type_alias = T;
+
+    // 构造：不在磁带上的常量
+    constexpr Var() : _value(0) {}
+
+    constexpr Var(T value) : _value(value) {}
+
+    // 访问
+    constexpr T value() const noexcept { return _value; }
+
+    constexpr std::size_t index() const noexcept { return _index; }
+
+    // 链式法则
+    Var Chain(T value, T slope) const { return Record(value, *this, slope); }
+
+    // 运算
+    friend Var operator+(const Var &lhs, const Var &rhs)
+    {
+        return Record(lhs._value + rhs._value, lhs, 1, rhs, 1);
+    }
+
+    friend Var operator-(const Var &lhs, const Var &rhs)
+    {
+        return Record(lhs._value - rhs._value, lhs, 1, rhs, -1);
+    }
+
+    friend Var operator*(const Var &lhs, const Var &rhs)
+    {
+        return Record(lhs._value * rhs._value, lhs, rhs._value, rhs, lhs._value);
+    }
+
+    friend Var operator/(const Var &lhs, const Var &rhs)
+    {
+        const T inv = static_cast<T>(1) / rhs._value;
+        const T q = lhs._value * inv;
+        return Record(q, lhs, inv, rhs, -q * inv);
+    }
+
+    Var operator-() const { return Chain(-_value, -1); }
+
+    // 复合赋值运算符
+    Var &operator+=(const Var &other) { return *this = *this + other; }
+
+    Var &operator-=(const Var &other) { return *this = *this - other; }
+
+    Var &operator*=(const Var &other) { return *this = *this * other; }
+
+    Var &operator/=(const Var &other) { return *this = *this / other; }
+
+    // 比较操作符：只比较值
+    friend bool operator==(const Var &lhs, const Var &rhs) { return lhs._value == rhs._value; }
+
+    friend auto operator<=>(const Var &lhs, const Var &rhs) { return lhs._value <=> rhs._value; }
+};
+
+template <std::floating_point T>
+Var<T> Tape<T>::Variable(T value)
+{
+    return Var<T>(value, this, Push(npos, 0, npos, 0));
+}
+
+template <std::floating_point T>
+std::vector<T> Tape<T>::Gradient(const Var<T> &output) const
+{
+    std::vector<T> adjoint(_nodes.size(), 0);
+    if (output._tape != this || output._index == npos)
+        return adjoint;
+
+    adjoint[output._index] = 1;
+    for (std::size_t i = output._index + 1; i-- > 0;)
+    {
+        const T a = adjoint[i];
+        if (a == 0)
+            continue;
+        for (std::size_t k = 0; k < 2; ++k)
+        {
+            if (_nodes[i].parent[k] != npos)
+                adjoint[_nodes[i].parent[k]] += a * _nodes[i].partial[k];
+        }
+    }
+    return adjoint;
+}
+
+template <std::floating_point T>
+struct Detail::IsScalarExtension<Var<T>> : std::true_type
+{
+};
+
+// 初等函数
+template <std::floating_point T>
+Var<T> sqrt(const Var<T> &x)
+{
+    const T root = std::sqrt(x.value());
+    return x.Chain(root, static_cast<T>(0.5) / root);
+}
+
+template <std::floating_point T>
+Var<T> abs(const Var<T> &x)
+{
+    return x.value() < 0 ? -x : x;
+}
+
+template <std::floating_point T>
+Var<T> exp(const Var<T> &x)
+{
+    const T e = std::exp(x.value());
+    return x.Chain(e, e);
+}
+
+template <std::floating_point T>
+Var<T> log(const Var<T> &x)
+{
+    return x.Chain(std::log(x.value()), static_cast<T>(1) / x.value());
+}
+
+template <std::floating_point T>
+Var<T> sin(const Var<T> &x)
+{
+    return x.Chain(std::sin(x.value()), std::cos(x.value()));
+}
+
+template <std::floating_point T>
+Var<T> cos(const Var<T> &x)
+{
+    return x.Chain(std::cos(x.value()), -std::sin(x.value()));
+}
+
+// 输出运算符
+template <std::floating_point T>
+std::ostream &operator<<(std::ostream &os, const Var<T> &x)
+{
+    os << x.value();
+    return os;
+}
+
+#endif // AUTODIFF_HPP
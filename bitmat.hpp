@@ -0,0 +1,278 @@
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include "mat.hpp"
+
+#ifndef BITMAT_HPP
+#define BITMAT_HPP
+
+// 位矩阵：每行打包为 (C + 63) / 64 个 64 位字，每个元素占 1 位
+template <size_t Row, size_t Col>
+struct BitMat final
+{
+    static constexpr size_t words_per_row = (Col + 63) / 64;
+
+private:
+    // 数据
+    std::array<std::uint64_t, Row * words_per_row> _words{};
+
+    // 行末字中有效位的掩码
+    static constexpr std::uint64_t TailMask = Col % 64 == 0 ? ~std::uint64_t(0) : (std::uint64_t(1) << (Col % 64)) - 1;
+
+public:
+    // 构造
+    constexpr BitMat() = default;
+
+    // 由普通矩阵构造：非零元素记为 1
+    template <Detail::NumericMat T>
+    constexpr explicit BitMat(const Mat<T, Row, Col> &mat)
+    {
+        for (size_t r = 0; r < Row; ++r)
+            for (size_t c = 0; c < Col; ++c)
+                if (mat[r, c] != T(0))
+                    Set(r, c, true);
+    }
+
+    static constexpr BitMat MakeIdentity()
+    {
+        static_assert(Row == Col, "Identity matrix must be square.");
+        BitMat result;
+        for (size_t i = 0; i < Row; ++i)
+            result.Set(i, i, true);
+        return result;
+    }
+
+    // 访问
+    constexpr bool operator[](size_t r, size_t c) const { return (_words[r * words_per_row + c / 64] >> (c % 64)) & 1u; }
+
+    constexpr void Set(size_t r, size_t c, bool value)
+    {
+        const std::uint64_t bit = std::uint64_t(1) << (c % 64);
+        std::uint64_t &word = _words[r * words_per_row + c / 64];
+        word = value ? (word | bit) : (word & ~bit);
+    }
+
+    constexpr std::uint64_t *RowWords(size_t r) { return _words.data() + r * words_per_row; }
+
+    constexpr const std::uint64_t *RowWords(size_t r) const { return _words.data() + r * words_per_row; }
+
+    // 转换为普通矩阵（元素为 0 或 1）
+    template <Detail::NumericMat T = int>
+    constexpr Mat<T, Row, Col> ToMat() const
+    {
+        Mat<T, Row, Col> result;
+        for (size_t r = 0; r < Row; ++r)
+            for (size_t c = 0; c < Col; ++c)
+                result[r, c] = (*this)[r, c] ? T(1) : T(0);
+        return result;
+    }
+
+    // 运算（逐元素）
+    constexpr BitMat &operator|=(const BitMat &other)
+    {
+        for (size_t i = 0; i < _words.size(); ++i)
+            _words[i] |= other._words[i];
+        return *this;
+    }
+
+    constexpr BitMat &operator&=(const BitMat &other)
+    {
+        for (size_t i = 0; i < _words.size(); ++i)
+            _words[i] &= other._words[i];
+        return *this;
+    }
+
+    constexpr BitMat &operator^=(const BitMat &other)
+    {
+        for (size_t i = 0; i < _words.size(); ++i)
+            _words[i] ^= other._words[i];
+        return *this;
+    }
+
+    constexpr BitMat operator~() const
+    {
+        BitMat result;
+        for (size_t r = 0; r < Row; ++r)
+        {
+            for (size_t w = 0; w < words_per_row; ++w)
+                result.RowWords(r)[w] = ~RowWords(r)[w];
+            if constexpr (words_per_row > 0)
+                result.RowWords(r)[words_per_row - 1] &= TailMask;
+        }
+        return result;
+    }
+
+    friend constexpr BitMat operator|(BitMat lhs, const BitMat &rhs) { return lhs |= rhs; }
+
+    friend constexpr BitMat operator&(BitMat lhs, const BitMat &rhs) { return lhs &= rhs; }
+
+    friend constexpr BitMat operator^(BitMat lhs, const BitMat &rhs) { return lhs ^= rhs; }
+
+    friend constexpr bool operator==(const BitMat &lhs, const BitMat &rhs) = default;
+
+    // 查询方法
+    constexpr size_t Count() const
+    {
+        size_t count = 0;
+        for (auto word : _words)
+            count += static_cast<size_t>(std::popcount(word));
+        return count;
+    }
+
+    static constexpr size_t row_size() noexcept { return Row; }
+
+    static constexpr size_t col_size() noexcept { return Col; }
+
+    static constexpr size_t size_in_bytes() noexcept { return sizeof(std::uint64_t) * Row * words_per_row; }
+};
+
+// 转置
+template <size_t Row, size_t Col>
+constexpr BitMat<Col, Row> Transpose(const BitMat<Row, Col> &mat)
+{
+    BitMat<Col, Row> result;
+    for (size_t r = 0; r < Row; ++r)
+    {
+        const std::uint64_t *row = mat.RowWords(r);
+        for (size_t w = 0; w < BitMat<Row, Col>::words_per_row; ++w)
+        {
+            for (std::uint64_t bits = row[w]; bits; bits &= bits - 1)
+                result.Set(w * 64 + static_cast<size_t>(std::countr_zero(bits)), r, true);
+        }
+    }
+    return result;
+}
+
+// 布尔积（OR-AND 半环）：C 的第 i 行为 A[i, k] = 1 的所有 B 第 k 行按位或
+template <size_t Row, size_t Inner, size_t Col>
+constexpr BitMat<Row, Col> operator*(const BitMat<Row, Inner> &lhs, const BitMat<Inner, Col> &rhs)
+{
+    BitMat<Row, Col> result;
+    for (size_t i = 0; i < Row; ++i)
+    {
+        std::uint64_t *out = result.RowWords(i);
+        const std::uint64_t *a = lhs.RowWords(i);
+        for (size_t w = 0; w < BitMat<Row, Inner>::words_per_row; ++w)
+        {
+            for (std::uint64_t bits = a[w]; bits; bits &= bits - 1)
+            {
+                const std::uint64_t *b = rhs.RowWords(w * 64 + static_cast<size_t>(std::countr_zero(bits)));
+                for (size_t v = 0; v < BitMat<Inner, Col>::words_per_row; ++v)
+                    out[v] |= b[v];
+            }
+        }
+    }
+    return result;
+}
+
+// GF(2) 积（XOR-AND 半环）
+template <size_t Row, size_t Inner, size_t Col>
+constexpr BitMat<Row, Col> MultiplyGF2(const BitMat<Row, Inner> &lhs, const BitMat<Inner, Col> &rhs)
+{
+    BitMat<Row, Col> result;
+    for (size_t i = 0; i < Row; ++i)
+    {
+        std::uint64_t *out = result.RowWords(i);
+        const std::uint64_t *a = lhs.RowWords(i);
+        for (size_t w = 0; w < BitMat<Row, Inner>::words_per_row; ++w)
+        {
+            for (std::uint64_t bits = a[w]; bits; bits &= bits - 1)
+            {
+                const std::uint64_t *b = rhs.RowWords(w * 64 + static_cast<size_t>(std::countr_zero(bits)));
+                for (size_t v = 0; v < BitMat<Inner, Col>::words_per_row; ++v)
+                    out[v] ^= b[v];
+            }
+        }
+    }
+    return result;
+}
+
+// 计数积：C[i, j] = popcount(A 第 i 行 & B 第 j 列)，即满足 A[i, k] = B[k, j] = 1 的 k 的个数
+// （邻接矩阵时为长度 2 的路径数）
+template <size_t Row, size_t Inner, size_t Col>
+constexpr Mat<std::uint32_t, Row, Col> CountProduct(const BitMat<Row, Inner> &lhs, const BitMat<Inner, Col> &rhs)
+{
+    const auto rhs_t = Transpose(rhs);
+    Mat<std::uint32_t, Row, Col> result;
+    for (size_t i = 0; i < Row; ++i)
+    {
+        const std::uint64_t *a = lhs.RowWords(i);
+        for (size_t j = 0; j < Col; ++j)
+        {
+            const std::uint64_t *b = rhs_t.RowWords(j);
+            std::uint32_t count = 0;
+            for (size_t w = 0; w < BitMat<Row, Inner>::words_per_row; ++w)
+                count += static_cast<std::uint32_t>(std::popcount(a[w] & b[w]));
+            result[i, j] = count;
+        }
+    }
+    return result;
+}
+
+// 传递闭包（Warshall，按行字并行）：结果中 (i, j) 为 1 当且仅当存在长度至少为 1 的 i 到 j 路径
+template <size_t Size>
+constexpr BitMat<Size, Size> TransitiveClosure(BitMat<Size, Size> mat)
+{
+    for (size_t k = 0; k < Size; ++k)
+    {
+        const std::uint64_t *row_k = mat.RowWords(k);
+        for (size_t i = 0; i < Size; ++i)
+        {
+            if (i == k || !mat[i, k])
+                continue;
+            std::uint64_t *row_i = mat.RowWords(i);
+            for (size_t w = 0; w < BitMat<Size, Size>::words_per_row; ++w)
+                row_i[w] |= row_k[w];
+        }
+    }
+    return mat;
+}
+
+// GF(2) 上的秩：按行异或消元
+template <size_t Row, size_t Col>
+constexpr size_t Rank(BitMat<Row, Col> mat)
+{
+    size_t rank = 0;
+    for (size_t c = 0; c < Col && rank < Row; ++c)
+    {
+        size_t pivot = rank;
+        while (pivot < Row && !mat[pivot, c])
+            ++pivot;
+        if (pivot == Row)
+            continue;
+        std::uint64_t *top = mat.RowWords(rank);
+        if (pivot != rank)
+        {
+            std::uint64_t *p = mat.RowWords(pivot);
+            for (size_t w = 0; w < BitMat<Row, Col>::words_per_row; ++w)
+                std::swap(top[w], p[w]);
+        }
+        for (size_t r = rank + 1; r < Row; ++r)
+        {
+            if (!mat[r, c])
+                continue;
+            std::uint64_t *row = mat.RowWords(r);
+            for (size_t w = c / 64; w < BitMat<Row, Col>::words_per_row; ++w)
+                row[w] ^= top[w];
+        }
+        ++rank;
+    }
+    return rank;
+}
+
+// 输出运算符
+template <size_t Row, size_t Col>
+std::ostream &operator<<(std::ostream &os, const BitMat<Row, Col> &mat)
+{
+    for (size_t r = 0; r < Row; ++r)
+    {
+        for (size_t c = 0; c < Col; ++c)
+            os << (mat[r, c] ? '1' : '0');
+        os << '\n';
+    }
+    return os;
+}
+
+#endif // BITMAT_HPP
@@ -0,0 +1,371 @@
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "gemm.hpp"
+
+#ifndef DISTRIBUTED_HPP
+#define DISTRIBUTED_HPP
+
+// 消息传输接口：rank 编号为 [0, size())。同一 (source, tag) 上的消息按发送顺序接收
+struct Transport
+{
+    virtual ~Transport() = default;
+
+    virtual int rank() const = 0;
+
+    virtual int size() const = 0;
+
+    virtual void Send(int destination, int tag, std::span<const std::byte> data) = 0;
+
+    // 阻塞直到收到来自 source、标签为 tag 的消息
+    virtual std::vector<std::byte> Receive(int source, int tag) = 0;
+};
+
+// 进程内传输：所有 rank 共享一组邮箱，用于单机测试；每个 rank 在自己的线程上使用 Endpoint(rank)
+struct InProcessFabric final
+{
+private:
+    struct Mailbox
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::map<std::pair<int, int>, std::deque<std::vector<std::byte>>> messages;
+    };
+
+    struct Port final : Transport
+    {
+        InProcessFabric *fabric = nullptr;
+        int id = 0;
+
+        int rank() const override { return id; }
+
+        int size() const override { return static_cast<int>(fabric->_mailboxes.size()); }
+
+        void Send(int destination, int tag, std::span<const std::byte> data) override
+        {
+            if (destination < 0 || destination >= size())
+            {
+                throw std::runtime_error("Transport destination out of range");
+            }
+            auto &box = *fabric->_mailboxes[static_cast<std::size_t>(destination)];
+            {
+                std::lock_guard lock(box.mutex);
+                box.messages[{id, tag}].emplace_back(data.begin(), data.end());
+            }
+            box.cv.notify_all();
+        }
+
+        std::vector<std::byte> Receive(int source, int tag) override
+        {
+            auto &box = *fabric->_mailboxes[static_cast<std::size_t>(id)];
+            std::unique_lock lock(box.mutex);
+            const std::pair<int, int> key{source, tag};
+            box.cv.wait(lock, [&]
+                        {
+                            auto it = box.messages.find(key);
+                            return it != box.messages.end() && !it->second.empty(); });
+            auto &queue = box.messages[key];
+            std::vector<std::byte> data = std::move(queue.front());
+            queue.pop_front();
+            return data;
+        }
+    };
+
+    // 数据
+    std::vector<std::unique_ptr<Mailbox>> _mailboxes;
+    std::vector<Port> _endpoints;
+
+public:
+    // 构造
+    explicit InProcessFabric(int ranks)
+    {
+        if (ranks <= 0)
+        {
+            throw std::runtime_error("InProcessFabric needs at least one rank");
+        }
+        _endpoints.resize(static_cast<std::size_t>(ranks));
+        for (int r = 0; r < ranks; ++r)
+        {
+            _mailboxes.push_back(std::make_unique<Mailbox>());
+            _endpoints[static_cast<std::size_t>(r)].fabric = this;
+            _endpoints[static_cast<std::size_t>(r)].id = r;
+        }
+    }
+
+    InProcessFabric(const InProcessFabric &) = delete;
+    InProcessFabric &operator=(const InProcessFabric &) = delete;
+
+    // 访问
+    Transport &Endpoint(int rank) { return _endpoints.at(static_cast<std::size_t>(rank)); }
+
+    // 查询方法
+    int size() const noexcept { return static_cast<int>(_endpoints.size()); }
+};
+
+// 二维进程网格：rank r 位于 (r / cols, r % cols)
+struct ProcessGrid final
+{
+    int rows = 1, cols = 1;
+
+    constexpr int Row(int rank) const { return rank / cols; }
+
+    constexpr int Col(int rank) const { return rank % cols; }
+
+    constexpr int Rank(int row, int col) const { return row * cols + col; }
+
+    constexpr int size() const { return rows * cols; }
+};
+
+namespace Detail
+{
+    // 块循环分布下进程 p 拥有的元素个数（global 个元素，块大小 block，共 procs 个进程）
+    inline std::size_t BlockCyclicCount(std::size_t global, std::size_t block, int p, int procs)
+    {
+        const std::size_t blocks = (global + block - 1) / block;
+        const std::size_t mine = blocks / static_cast<std::size_t>(procs) +
+                                 (static_cast<std::size_t>(p) < blocks % static_cast<std::size_t>(procs) ? 1 : 0);
+        std::size_t count = mine * block;
+        // 最后一个块可能不满
+        if (blocks > 0 && (blocks - 1) % static_cast<std::size_t>(procs) == static_cast<std::size_t>(p))
+            count -= blocks * block - global;
+        return count;
+    }
+
+    template <typename T>
+    void SendValues(Transport &transport, int destination, int tag, std::span<const T> values)
+    {
+        transport.Send(destination, tag, std::as_bytes(values));
+    }
+
+    template <typename T>
+    void ReceiveValues(Transport &transport, int source, int tag, std::vector<T> &out)
+    {
+        const auto bytes = transport.Receive(source, tag);
+        out.resize(bytes.size() / sizeof(T));
+        std::memcpy(out.data(), bytes.data(), bytes.size());
+    }
+
+    // 在一组 rank 内由 root 广播；root 逐个发送，可替换为树形广播而不影响调用方
+    template <typename T>
+    void GroupBroadcast(Transport &transport, std::span<const int> group, int root, int tag, std::vector<T> &values)
+    {
+        if (transport.rank() == root)
+        {
+            for (int member : group)
+                if (member != root)
+                    SendValues<T>(transport, member, tag, values);
+        }
+        else
+        {
+            ReceiveValues(transport, root, tag, values);
+        }
+    }
+}
+
+// 二维块循环分布矩阵：每个 rank 只保存本地块（行主序），全局第 (i, j) 块属于网格位置 (i % rows, j % cols)
+template <typename T>
+struct DistributedMatrix final
+{
+    static_assert(std::is_trivially_copyable_v<T>, "DistributedMatrix elements are sent as raw bytes");
+
+private:
+    // 数据
+    Transport *_transport = nullptr;
+    ProcessGrid _grid;
+    std::size_t _rows = 0, _cols = 0, _block = 1;
+    std::size_t _local_rows = 0, _local_cols = 0;
+    std::vector<T> _local;
+
+    // 本地下标与全局下标的转换
+    std::size_t GlobalRow(std::size_t local, int grid_row) const
+    {
+        return ((local / _block) * static_cast<std::size_t>(_grid.rows) + static_cast<std::size_t>(grid_row)) * _block + local % _block;
+    }
+
+    std::size_t GlobalCol(std::size_t local, int grid_col) const
+    {
+        return ((local / _block) * static_cast<std::size_t>(_grid.cols) + static_cast<std::size_t>(grid_col)) * _block + local % _block;
+    }
+
+public:
+    // 构造：所有 rank 以相同参数构造
+    DistributedMatrix(Transport &transport, ProcessGrid grid, std::size_t rows, std::size_t cols, std::size_t block = 64)
+        : _transport(&transport), _grid(grid), _rows(rows), _cols(cols), _block(block)
+    {
+        if (grid.size() != transport.size())
+        {
+            throw std::runtime_error("ProcessGrid size does not match the transport");
+        }
+        if (block == 0)
+        {
+            throw std::runtime_error("DistributedMatrix block size must be positive");
+        }
+        _local_rows = Detail::BlockCyclicCount(rows, block, grid.Row(transport.rank()), grid.rows);
+        _local_cols = Detail::BlockCyclicCount(cols, block, grid.Col(transport.rank()), grid.cols);
+        _local.assign(_local_rows * _local_cols, T(0));
+    }
+
+    // 由 root 把全局矩阵分发到各 rank（global 只在 root 上读取）
+    void Scatter(MatrixView<const T> global, int root = 0)
+    {
+        Transport &t = *_transport;
+        if (t.rank() == root)
+        {
+            if (global.rows != _rows || global.cols != _cols)
+            {
+                throw std::runtime_error("Scatter dimension mismatch");
+            }
+            std::vector<T> buffer;
+            for (int r = 0; r < t.size(); ++r)
+            {
+                const int gr = _grid.Row(r), gc = _grid.Col(r);
+                const std::size_t lr = Detail::BlockCyclicCount(_rows, _block, gr, _grid.rows);
+                const std::size_t lc = Detail::BlockCyclicCount(_cols, _block, gc, _grid.cols);
+                buffer.resize(lr * lc);
+                for (std::size_t i = 0; i < lr; ++i)
+                    for (std::size_t j = 0; j < lc; ++j)
+                        buffer[i * lc + j] = global[GlobalRow(i, gr), GlobalCol(j, gc)];
+                if (r == root)
+                    _local = buffer;
+                else
+                    Detail::SendValues<T>(t, r, -1, buffer);
+            }
+        }
+        else
+        {
+            Detail::ReceiveValues(t, root, -1, _local);
+        }
+    }
+
+    // 把各 rank 的本地块汇集到 root 上的全局矩阵（global 只在 root 上写入）
+    void Gather(MatrixView<T> global, int root = 0) const
+    {
+        Transport &t = *_transport;
+        if (t.rank() != root)
+        {
+            Detail::SendValues<T>(t, root, -2, _local);
+            return;
+        }
+        if (global.rows != _rows || global.cols != _cols)
+        {
+            throw std::runtime_error("Gather dimension mismatch");
+        }
+        std::vector<T> buffer;
+        for (int r = 0; r < t.size(); ++r)
+        {
+            const int gr = _grid.Row(r), gc = _grid.Col(r);
+            const std::size_t lr = Detail::BlockCyclicCount(_rows, _block, gr, _grid.rows);
+            const std::size_t lc = Detail::BlockCyclicCount(_cols, _block, gc, _grid.cols);
+            if (r == root)
+                buffer = _local;
+            else
+                Detail::ReceiveValues(t, r, -2, buffer);
+            for (std::size_t i = 0; i < lr; ++i)
+                for (std::size_t j = 0; j < lc; ++j)
+                    global[GlobalRow(i, gr), GlobalCol(j, gc)] = buffer[i * lc + j];
+        }
+    }
+
+    // 访问
+    MatrixView<T> Local() { return MatrixView<T>(_local.data(), _local_rows, _local_cols); }
+
+    MatrixView<const T> Local() const { return MatrixView<const T>(_local.data(), _local_rows, _local_cols); }
+
+    Transport &transport() const noexcept { return *_transport; }
+
+    // 查询方法
+    const ProcessGrid &grid() const noexcept { return _grid; }
+
+    std::size_t rows() const noexcept { return _rows; }
+
+    std::size_t cols() const noexcept { return _cols; }
+
+    std::size_t block() const noexcept { return _block; }
+};
+
+// SUMMA：对第 k 个块列/块行，拥有 A 块列的进程沿网格行广播 A 面板，
+// 拥有 B 块行的进程沿网格列广播 B 面板，各 rank 用 Gemm 累加到本地 C 块。所有 rank 须同时调用
+template <Detail::FloatPolicy P, typename T>
+void SummaMultiply(P, const DistributedMatrix<T> &a, const DistributedMatrix<T> &b, DistributedMatrix<T> &c,
+                   const GemmConfig &config = ActiveTuneProfile().gemm)
+{
+    if (a.cols() != b.rows() || c.rows() != a.rows() || c.cols() != b.cols())
+    {
+        throw std::runtime_error("SummaMultiply dimension mismatch");
+    }
+    const ProcessGrid &grid = a.grid();
+    if (grid.rows != b.grid().rows || grid.cols != b.grid().cols || grid.rows != c.grid().rows ||
+        grid.cols != c.grid().cols || a.block() != b.block() || a.block() != c.block())
+    {
+        throw std::runtime_error("SummaMultiply requires the same grid and block size");
+    }
+
+    Transport &t = c.transport();
+    const int me = t.rank();
+    const int my_row = grid.Row(me), my_col = grid.Col(me);
+    const std::size_t nb = a.block();
+    const std::size_t k_blocks = (a.cols() + nb - 1) / nb;
+
+    std::vector<int> row_group, col_group;
+    for (int j = 0; j < grid.cols; ++j)
+        row_group.push_back(grid.Rank(my_row, j));
+    for (int i = 0; i < grid.rows; ++i)
+        col_group.push_back(grid.Rank(i, my_col));
+
+    const auto a_local = a.Local();
+    const auto b_local = b.Local();
+    auto c_local = c.Local();
+    std::vector<T> a_panel, b_panel;
+
+    for (std::size_t kb = 0; kb < k_blocks; ++kb)
+    {
+        const std::size_t width = std::min(nb, a.cols() - kb * nb);
+        const int owner_col = static_cast<int>(kb % static_cast<std::size_t>(grid.cols));
+        const int owner_row = static_cast<int>(kb % static_cast<std::size_t>(grid.rows));
+        const int tag = static_cast<int>(kb);
+
+        // A 面板：本地所有行 x 第 kb 块列
+        if (my_col == owner_col)
+        {
+            const std::size_t offset = kb / static_cast<std::size_t>(grid.cols) * nb;
+            a_panel.resize(a_local.rows * width);
+            for (std::size_t i = 0; i < a_local.rows; ++i)
+                std::memcpy(a_panel.data() + i * width, &a_local[i, offset], width * sizeof(T));
+        }
+        Detail::GroupBroadcast(t, row_group, grid.Rank(my_row, owner_col), 2 * tag, a_panel);
+
+        // B 面板：第 kb 块行 x 本地所有列
+        if (my_row == owner_row)
+        {
+            const std::size_t offset = kb / static_cast<std::size_t>(grid.rows) * nb;
+            b_panel.resize(width * b_local.cols);
+            for (std::size_t i = 0; i < width; ++i)
+                std::memcpy(b_panel.data() + i * b_local.cols, &b_local[offset + i, 0], b_local.cols * sizeof(T));
+        }
+        Detail::GroupBroadcast(t, col_group, grid.Rank(owner_row, my_col), 2 * tag + 1, b_panel);
+
+        Gemm(P{}, MatrixView<const T>(a_panel.data(), c_local.rows, width),
+             MatrixView<const T>(b_panel.data(), width, c_local.cols), c_local, config);
+    }
+}
+
+// 分布式乘法：结果与 a 使用相同的传输、网格与块大小
+template <typename T>
+DistributedMatrix<T> operator*(const DistributedMatrix<T> &a, const DistributedMatrix<T> &b)
+{
+    DistributedMatrix<T> c(a.transport(), a.grid(), a.rows(), b.cols(), a.block());
+    SummaMultiply(DefaultPolicy{}, a, b, c);
+    return c;
+}
+
+#endif // DISTRIBUTED_HPP
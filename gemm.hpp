@@ -0,0 +1,194 @@
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include "policy.hpp"
+#include "pool.hpp"
+#include "tune.hpp"
+
+#ifndef GEMM_HPP
+#define GEMM_HPP
+
+// 行主序矩阵视图：不拥有数据，第 r 行起始于 data + r * stride
+template <typename T>
+struct MatrixView final
+{
+    T *data = nullptr;
+    std::size_t rows = 0, cols = 0, stride = 0;
+
+    // 构造
+    constexpr MatrixView() = default;
+
+    constexpr MatrixView(T *data, std::size_t rows, std::size_t cols) : data(data), rows(rows), cols(cols), stride(cols) {}
+
+    constexpr MatrixView(T *data, std::size_t rows, std::size_t cols, std::size_t stride)
+        : data(data), rows(rows), cols(cols), stride(stride)
+    {
+    }
+
+    // 非 const 视图可隐式转换为 const 视图
+    constexpr operator MatrixView<const T>() const
+        requires(!std::is_const_v<T>)
+    {
+        return MatrixView<const T>(data, rows, cols, stride);
+    }
+
+    // 访问
+    constexpr T &operator[](std::size_t r, std::size_t c) const { return data[r * stride + c]; }
+
+    constexpr T *Row(std::size_t r) const { return data + r * stride; }
+
+    // 子块：[row, row + rows) x [col, col + cols)
+    constexpr MatrixView Block(std::size_t row, std::size_t col, std::size_t block_rows, std::size_t block_cols) const
+    {
+        return MatrixView(data + row * stride + col, block_rows, block_cols, stride);
+    }
+};
+
+namespace Detail
+{
+    inline void CheckGemmShape(std::size_t a_rows, std::size_t a_cols, std::size_t b_rows, std::size_t b_cols,
+                               std::size_t c_rows, std::size_t c_cols)
+    {
+        if (a_cols != b_rows || c_rows != a_rows || c_cols != b_cols)
+        {
+            throw std::runtime_error("Gemm dimension mismatch");
+        }
+    }
+
+    // 块内核：i-k-j 顺序，最内层沿 C 与 B 的行连续访问，便于向量化；
+    // op(a_ik, b_kj, c_ij) 返回累加后的 c_ij（乘加或其他半环运算）
+    template <typename T, typename Op>
+    void GemmKernel(MatrixView<const T> a, MatrixView<const T> b, MatrixView<T> c, Op &op)
+    {
+        for (std::size_t i = 0; i < a.rows; ++i)
+        {
+            T *c_row = c.Row(i);
+            const T *a_row = a.Row(i);
+            for (std::size_t p = 0; p < a.cols; ++p)
+            {
+                const T a_ip = a_row[p];
+                const T *b_row = b.Row(p);
+                for (std::size_t j = 0; j < b.cols; ++j)
+                    c_row[j] = op(a_ip, b_row[j], c_row[j]);
+            }
+        }
+    }
+
+    // 处理 C 的一个行块 [row, row + rows)：按 n、k 方向分块依次调用内核
+    template <typename T, typename Op>
+    void GemmRowBlock(MatrixView<const T> a, MatrixView<const T> b, MatrixView<T> c, const GemmConfig &config,
+                      std::size_t row, std::size_t rows, Op &op)
+    {
+        for (std::size_t col = 0; col < b.cols; col += config.block_n)
+        {
+            const std::size_t cols = std::min(config.block_n, b.cols - col);
+            for (std::size_t depth = 0; depth < a.cols; depth += config.block_k)
+            {
+                const std::size_t depths = std::min(config.block_k, a.cols - depth);
+                GemmKernel<T>(a.Block(row, depth, rows, depths), b.Block(depth, col, depths, cols),
+                              c.Block(row, col, rows, cols), op);
+            }
+        }
+    }
+
+    // 分块驱动：串行或按 block_m 行块分发到线程池
+    template <typename T, typename Op>
+    void GemmBlocked(MatrixView<const T> a, MatrixView<const T> b, MatrixView<T> c, const GemmConfig &cfg, Op op)
+    {
+        for (std::size_t row = 0; row < a.rows; row += cfg.block_m)
+            GemmRowBlock<T>(a, b, c, cfg, row, std::min(cfg.block_m, a.rows - row), op);
+    }
+
+    // 运算量低于调优配置的 parallel_min_flops 时走串行；threads 限制同时处理的行块组数
+    template <typename T, typename Op>
+    void GemmBlocked(MatrixView<const T> a, MatrixView<const T> b, MatrixView<T> c, const GemmConfig &cfg, Op op,
+                     ThreadPool &pool)
+    {
+        const TuneProfile profile = ActiveTuneProfile();
+        const std::size_t blocks = (a.rows + cfg.block_m - 1) / cfg.block_m;
+        if (blocks <= 1 || 2 * a.rows * a.cols * b.cols < profile.parallel_min_flops)
+        {
+            GemmBlocked<T>(a, b, c, cfg, op);
+            return;
+        }
+        const std::size_t groups = profile.threads ? std::min(profile.threads, blocks) : blocks;
+        ParallelFor(pool, 0, blocks, (blocks + groups - 1) / groups, [&](std::size_t block)
+                    {
+                        const std::size_t row = block * cfg.block_m;
+                        GemmRowBlock<T>(a, b, c, cfg, row, std::min(cfg.block_m, a.rows - row), op); });
+    }
+
+    inline GemmConfig CheckedConfig(GemmConfig config)
+    {
+        config.block_m = std::max<std::size_t>(config.block_m, 1);
+        config.block_n = std::max<std::size_t>(config.block_n, 1);
+        config.block_k = std::max<std::size_t>(config.block_k, 1);
+        return config;
+    }
+}
+
+// 分块转置：dst = src^T，按 block x block 的块读写，使源与目标都在缓存内访问；
+// block 为 0 时使用调优配置中的 transpose_block
+template <typename T>
+void Transpose(std::type_identity_t<MatrixView<const T>> src, MatrixView<T> dst, std::size_t block = 0)
+{
+    if (dst.rows != src.cols || dst.cols != src.rows)
+    {
+        throw std::runtime_error("Transpose dimension mismatch");
+    }
+    if (block == 0)
+        block = std::max<std::size_t>(ActiveTuneProfile().transpose_block, 1);
+    for (std::size_t row = 0; row < src.rows; row += block)
+    {
+        const std::size_t row_end = std::min(row + block, src.rows);
+        for (std::size_t col = 0; col < src.cols; col += block)
+        {
+            const std::size_t col_end = std::min(col + block, src.cols);
+            for (std::size_t r = row; r < row_end; ++r)
+                for (std::size_t c = col; c < col_end; ++c)
+                    dst[c, r] = src[r, c];
+        }
+    }
+}
+
+// 分块矩阵乘法：C += A * B。每个 C 元素按固定的 k 块顺序累加，
+// 结果只取决于 GemmConfig，与线程数无关。未给出 config 时使用当前调优配置（见 tune.hpp）
+template <Detail::FloatPolicy P, typename T>
+void Gemm(P, std::type_identity_t<MatrixView<const T>> a, std::type_identity_t<MatrixView<const T>> b, MatrixView<T> c,
+          const GemmConfig &config = ActiveTuneProfile().gemm)
+{
+    RMATH_TRACE_SCOPE("Gemm");
+    Detail::CheckPolicy<P>();
+    Detail::CheckGemmShape(a.rows, a.cols, b.rows, b.cols, c.rows, c.cols);
+    Detail::GemmBlocked<T>(a, b, c, Detail::CheckedConfig(config), [](T x, T y, T acc)
+                           { return Detail::MulAdd<P, T>(x, y, acc); });
+}
+
+template <typename T>
+void Gemm(std::type_identity_t<MatrixView<const T>> a, std::type_identity_t<MatrixView<const T>> b, MatrixView<T> c,
+          const GemmConfig &config = ActiveTuneProfile().gemm)
+{
+    Gemm(DefaultPolicy{}, a, b, c, config);
+}
+
+// 并行版本：按 block_m 行块分发到线程池
+template <Detail::FloatPolicy P, typename T>
+void Gemm(P, std::type_identity_t<MatrixView<const T>> a, std::type_identity_t<MatrixView<const T>> b, MatrixView<T> c,
+          ThreadPool &pool, const GemmConfig &config = ActiveTuneProfile().gemm)
+{
+    RMATH_TRACE_SCOPE("Gemm");
+    Detail::CheckPolicy<P>();
+    Detail::CheckGemmShape(a.rows, a.cols, b.rows, b.cols, c.rows, c.cols);
+    Detail::GemmBlocked<T>(a, b, c, Detail::CheckedConfig(config), [](T x, T y, T acc)
+                           { return Detail::MulAdd<P, T>(x, y, acc); }, pool);
+}
+
+template <typename T>
+void Gemm(std::type_identity_t<MatrixView<const T>> a, std::type_identity_t<MatrixView<const T>> b, MatrixView<T> c,
+          ThreadPool &pool, const GemmConfig &config = ActiveTuneProfile().gemm)
+{
+    Gemm(DefaultPolicy{}, a, b, c, pool, config);
+}
+
+#endif // GEMM_HPP
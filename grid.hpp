@@ -0,0 +1,307 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include "range.hpp"
+#include "vec.hpp"
+#include "pool.hpp"
+
+#ifndef GRID_HPP
+#define GRID_HPP
+
+// 网格遍历顺序：RowMajor 为第 0 维最快变化；Tiled 先遍历块内再遍历块；
+// Morton 按各维比特交织的 Z 序遍历
+enum class GridOrder
+{
+    RowMajor,
+    Tiled,
+    Morton
+};
+
+// 多维范围：每一维是一个整数 Range，迭代产生 Vec<T, D> 下标
+template <std::integral T, std::size_t D>
+struct RangeND final
+{
+    static_assert(D >= 1, "RangeND needs at least one dimension");
+
+private:
+    // 数据
+    Vec<T, D> _start, _step;
+    std::array<std::size_t, D> _extent{};
+    std::array<std::size_t, D> _tile{};
+    std::size_t _size = 0;
+    GridOrder _order = GridOrder::RowMajor;
+
+    // Morton 码第 j 位属于哪一维；只给仍有剩余比特的维度分配位，
+    // 使编码空间不超过 2^D * size()
+    std::array<std::uint8_t, 64> _morton_dim{};
+    std::size_t _morton_bits = 0;
+
+    constexpr void Init()
+    {
+        _size = 1;
+        for (std::size_t d = 0; d < D; ++d)
+        {
+            _size *= _extent[d];
+            _tile[d] = _extent[d] == 0 ? 1 : _extent[d];
+        }
+        std::array<std::size_t, D> bits{};
+        std::size_t levels = 0;
+        for (std::size_t d = 0; d < D; ++d)
+        {
+            bits[d] = _extent[d] > 1 ? static_cast<std::size_t>(std::bit_width(_extent[d] - 1)) : 0;
+            levels = std::max(levels, bits[d]);
+        }
+        _morton_bits = 0;
+        for (std::size_t level = 0; level < levels; ++level)
+        {
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                if (level >= bits[d])
+                    continue;
+                if (_morton_bits == 64)
+                {
+                    throw std::runtime_error("RangeND is too large for Morton order");
+                }
+                _morton_dim[_morton_bits++] = static_cast<std::uint8_t>(d);
+            }
+        }
+    }
+
+    template <int Start, int End, int Step>
+    static constexpr Range<T> ToRange(StaticRange<Start, End, Step>)
+    {
+        return Range<T>(static_cast<T>(Start), static_cast<T>(End), static_cast<T>(Step));
+    }
+
+public:
+    // 迭代器：保存当前各维的步数偏移，按遍历顺序增量推进
+    struct Iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Vec<T, D>;
+        using difference_type = std::ptrdiff_t;
+
+        const RangeND *grid = nullptr;
+        std::size_t index = 0;
+        std::array<std::size_t, D> pos{};
+        std::array<std::size_t, D> tile_origin{};
+        std::uint64_t code = 0;
+
+        constexpr Vec<T, D> operator*() const
+        {
+            Vec<T, D> result;
+            for (std::size_t d = 0; d < D; ++d)
+                result[d] = static_cast<T>(grid->_start[d] + static_cast<T>(pos[d]) * grid->_step[d]);
+            return result;
+        }
+
+        constexpr Iterator &operator++()
+        {
+            if (++index < grid->_size)
+                grid->Advance(*this);
+            return *this;
+        }
+
+        constexpr Iterator operator++(int)
+        {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        constexpr bool operator==(const Iterator &other) const { return index == other.index; }
+        constexpr bool operator!=(const Iterator &other) const { return index != other.index; }
+    };
+
+    // 构造
+    constexpr RangeND(const Vec<T, D> &start, const Vec<T, D> &end, const Vec<T, D> &step = Vec<T, D>(T(1)))
+        : _start(start), _step(step)
+    {
+        for (std::size_t d = 0; d < D; ++d)
+            _extent[d] = Range<T>(start[d], end[d], step[d]).size();
+        Init();
+    }
+
+    template <typename... R>
+        requires(sizeof...(R) == D && (std::same_as<R, Range<T>> && ...))
+    constexpr RangeND(const R &...ranges)
+    {
+        std::size_t d = 0;
+        ((_start[d] = ranges.start(), _step[d] = ranges.step(), _extent[d] = ranges.size(), ++d), ...);
+        Init();
+    }
+
+    template <int... Start, int... End, int... Step>
+        requires(sizeof...(Start) == D)
+    constexpr RangeND(StaticRange<Start, End, Step>... ranges) : RangeND(ToRange(ranges)...)
+    {
+    }
+
+    // 遍历顺序（返回新范围，原范围不变）
+    constexpr RangeND RowMajor() const
+    {
+        RangeND result = *this;
+        result._order = GridOrder::RowMajor;
+        return result;
+    }
+
+    constexpr RangeND Tiled(const std::array<std::size_t, D> &tile) const
+    {
+        RangeND result = *this;
+        for (std::size_t d = 0; d < D; ++d)
+        {
+            if (tile[d] == 0)
+            {
+                throw std::runtime_error("RangeND tile size must be positive");
+            }
+            result._tile[d] = tile[d];
+        }
+        result._order = GridOrder::Tiled;
+        return result;
+    }
+
+    constexpr RangeND Morton() const
+    {
+        RangeND result = *this;
+        result._order = GridOrder::Morton;
+        return result;
+    }
+
+    // 并行划分：沿最慢变化的一维切成 parts 份，返回第 part 份；
+    // 切分点对齐到块边界（Tiled）或 2 的幂（Morton），各份保持原遍历顺序
+    constexpr RangeND Partition(std::size_t part, std::size_t parts) const
+    {
+        if (parts == 0 || part >= parts)
+        {
+            throw std::runtime_error("RangeND partition index out of range");
+        }
+        const std::size_t n = _extent[D - 1];
+        std::size_t align = 1;
+        if (_order == GridOrder::Tiled)
+            align = _tile[D - 1];
+        std::size_t chunk = (n + parts - 1) / parts;
+        chunk = (chunk + align - 1) / align * align;
+        if (_order == GridOrder::Morton && chunk > 1)
+            chunk = std::bit_ceil(chunk);
+
+        const std::size_t first = std::min(n, part * chunk);
+        const std::size_t last = std::min(n, first + chunk);
+        RangeND result = *this;
+        result._start[D - 1] = static_cast<T>(_start[D - 1] + static_cast<T>(first) * _step[D - 1]);
+        result._extent[D - 1] = last - first;
+        const auto tile = _tile;
+        result.Init();
+        result._tile = tile;
+        return result;
+    }
+
+    constexpr Iterator begin() const
+    {
+        Iterator it;
+        it.grid = this;
+        return it;
+    }
+
+    constexpr Iterator end() const
+    {
+        Iterator it;
+        it.grid = this;
+        it.index = _size;
+        return it;
+    }
+
+    // 查询方法
+    constexpr std::size_t size() const noexcept { return _size; }
+
+    constexpr std::size_t extent(std::size_t dim) const { return _extent[dim]; }
+
+    constexpr GridOrder order() const noexcept { return _order; }
+
+private:
+    constexpr void Advance(Iterator &it) const
+    {
+        switch (_order)
+        {
+        case GridOrder::RowMajor:
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                if (++it.pos[d] < _extent[d])
+                    return;
+                it.pos[d] = 0;
+            }
+            return;
+
+        case GridOrder::Tiled:
+            // 块内推进
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                if (++it.pos[d] < std::min(it.tile_origin[d] + _tile[d], _extent[d]))
+                    return;
+                it.pos[d] = it.tile_origin[d];
+            }
+            // 块间推进
+            for (std::size_t d = 0; d < D; ++d)
+            {
+                it.tile_origin[d] += _tile[d];
+                if (it.tile_origin[d] < _extent[d])
+                    break;
+                it.tile_origin[d] = 0;
+            }
+            it.pos = it.tile_origin;
+            return;
+
+        case GridOrder::Morton:
+            // 跳过落在范围外的编码
+            for (;;)
+            {
+                ++it.code;
+                std::array<std::size_t, D> pos{};
+                std::array<std::size_t, D> shift{};
+                for (std::size_t j = 0; j < _morton_bits; ++j)
+                {
+                    const std::size_t d = _morton_dim[j];
+                    pos[d] |= static_cast<std::size_t>((it.code >> j) & 1u) << shift[d]++;
+                }
+                bool inside = true;
+                for (std::size_t d = 0; d < D; ++d)
+                    inside = inside && pos[d] < _extent[d];
+                if (inside)
+                {
+                    it.pos = pos;
+                    return;
+                }
+            }
+        }
+    }
+};
+
+template <std::integral T, typename... R>
+RangeND(const Range<T> &, const R &...) -> RangeND<T, sizeof...(R) + 1>;
+
+template <int... Start, int... End, int... Step>
+RangeND(StaticRange<Start, End, Step>...) -> RangeND<int, sizeof...(Start)>;
+
+template <typename T>
+using Range2D = RangeND<T, 2>;
+
+template <typename T>
+using Range3D = RangeND<T, 3>;
+
+// 在线程池上并行遍历网格：每个任务处理一个 Partition，块内保持 grid 的遍历顺序
+template <std::integral T, std::size_t D, typename F>
+void ParallelFor(ThreadPool &pool, const RangeND<T, D> &grid, F &&fn)
+{
+    const std::size_t parts = std::max<std::size_t>(1, std::min(grid.extent(D - 1), (pool.size() + 1) * 4));
+    ParallelFor(pool, 0, parts, 1, [&](std::size_t part)
+                {
+                    const auto sub = grid.Partition(part, parts);
+                    for (const auto &index : sub)
+                        fn(index); });
+}
+
+#endif // GRID_HPP
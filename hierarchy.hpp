@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "mat.hpp"
+#include "transform.hpp"
+#include "pool.hpp"
+
+#ifndef HIERARCHY_HPP
+#define HIERARCHY_HPP
+
+// 变换层级：脏节点按深度分层处理，同层节点互不依赖，可并行传播；
+// 每次 Update 只访问被修改节点的子树，代价与受影响节点数成正比。局部变换须为仿射矩阵（最后一行为 0 0 0 1）
+template <std::floating_point T>
+struct TransformHierarchy final
+{
+private:
+    // 数据（按节点编号存放）
+    std::vector<std::size_t> _parent;
+    std::vector<std::size_t> _depth;
+    std::vector<Mat<T, 4, 4>> _local;
+    std::vector<Mat<T, 4, 4>> _world;
+    std::vector<std::uint8_t> _dirty;
+    std::vector<std::uint8_t> _queued;
+
+    // 自上次 Update 以来被修改的节点
+    std::vector<std::size_t> _dirty_nodes;
+
+    // 子节点表（CSR）：节点 i 的子节点为 _children[_child_offset[i] .. _child_offset[i + 1])
+    std::vector<std::size_t> _child_offset;
+    std::vector<std::size_t> _children;
+    std::size_t _levels = 0;
+    bool _children_dirty = false;
+
+    // 按深度分层的待更新节点，跨帧复用内存
+    std::vector<std::vector<std::size_t>> _frontier;
+
+    void RebuildChildren()
+    {
+        const std::size_t n = _parent.size();
+        _child_offset.assign(n + 1, 0);
+        _levels = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            _levels = std::max(_levels, _depth[i] + 1);
+            if (_parent[i] != npos)
+                ++_child_offset[_parent[i] + 1];
+        }
+        for (std::size_t i = 0; i < n; ++i)
+            _child_offset[i + 1] += _child_offset[i];
+
+        _children.resize(_child_offset[n]);
+        std::vector<std::size_t> cursor(_child_offset.begin(), _child_offset.end() - 1);
+        for (std::size_t i = 0; i < n; ++i)
+            if (_parent[i] != npos)
+                _children[cursor[_parent[i]]++] = i;
+        if (_frontier.size() < _levels)
+            _frontier.resize(_levels);
+        _children_dirty = false;
+    }
+
+    void MarkDirty(std::size_t node)
+    {
+        if (!_dirty[node])
+        {
+            _dirty[node] = 1;
+            _dirty_nodes.push_back(node);
+        }
+    }
+
+    void UpdateNode(std::size_t i)
+    {
+        const std::size_t p = _parent[i];
+        _world[i] = (p == npos) ? _local[i] : AffineMultiply(_world[p], _local[i]);
+    }
+
+    // 把脏节点放入各自深度的层；返回 false 表示无事可做
+    bool BeginUpdate()
+    {
+        if (_dirty_nodes.empty())
+            return false;
+        if (_children_dirty)
+            RebuildChildren();
+        for (auto node : _dirty_nodes)
+        {
+            if (!_queued[node])
+            {
+                _queued[node] = 1;
+                _frontier[_depth[node]].push_back(node);
+            }
+        }
+        return true;
+    }
+
+    // 第 d 层更新完成后，把其子节点加入第 d + 1 层
+    void ExpandLevel(std::size_t d)
+    {
+        for (auto node : _frontier[d])
+        {
+            for (std::size_t k = _child_offset[node]; k < _child_offset[node + 1]; ++k)
+            {
+                const std::size_t child = _children[k];
+                if (!_queued[child])
+                {
+                    _queued[child] = 1;
+                    _frontier[d + 1].push_back(child);
+                }
+            }
+        }
+    }
+
+    // 只清除本次访问过的节点的标记
+    void EndUpdate()
+    {
+        for (std::size_t d = 0; d < _levels; ++d)
+        {
+            for (auto node : _frontier[d])
+            {
+                _queued[node] = 0;
+                _dirty[node] = 0;
+            }
+            _frontier[d].clear();
+        }
+        _dirty_nodes.clear();
+    }
+
+public:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    // 同层待更新节点数达到该值时才分发到线程池
+    static constexpr std::size_t parallel_threshold = 1024;
+
+    // 构造
+    TransformHierarchy() = default;
+
+    // 添加节点：parent 为 npos 表示根节点，返回节点编号
+    std::size_t AddNode(const Mat<T, 4, 4> &local, std::size_t parent = npos)
+    {
+        if (parent != npos && parent >= _parent.size())
+        {
+            throw std::runtime_error("Parent node does not exist");
+        }
+        _parent.push_back(parent);
+        _depth.push_back(parent == npos ? 0 : _depth[parent] + 1);
+        _local.push_back(local);
+        _world.push_back(local);
+        _dirty.push_back(0);
+        _queued.push_back(0);
+        _children_dirty = true;
+        MarkDirty(_parent.size() - 1);
+        return _parent.size() - 1;
+    }
+
+    // 修改局部变换，下次 Update 时重算其子树
+    void SetLocal(std::size_t node, const Mat<T, 4, 4> &local)
+    {
+        _local[node] = local;
+        MarkDirty(node);
+    }
+
+    // 传播到世界空间
+    void Update()
+    {
+        if (!BeginUpdate())
+            return;
+        for (std::size_t d = 0; d < _levels; ++d)
+        {
+            for (auto node : _frontier[d])
+                UpdateNode(node);
+            if (d + 1 < _levels)
+                ExpandLevel(d);
+        }
+        EndUpdate();
+    }
+
+    void Update(ThreadPool &pool)
+    {
+        if (!BeginUpdate())
+            return;
+        for (std::size_t d = 0; d < _levels; ++d)
+        {
+            const auto &level = _frontier[d];
+            if (level.size() >= parallel_threshold)
+            {
+                ParallelFor(pool, 0, level.size(), parallel_threshold / 4, [&](std::size_t j)
+                            { UpdateNode(level[j]); });
+            }
+            else
+            {
+                for (auto node : level)
+                    UpdateNode(node);
+            }
+            if (d + 1 < _levels)
+                ExpandLevel(d);
+        }
+        EndUpdate();
+    }
+
+    // 访问
+    const Mat<T, 4, 4> &Local(std::size_t node) const { return _local[node]; }
+
+    const Mat<T, 4, 4> &World(std::size_t node) const { return _world[node]; }
+
+    std::size_t Parent(std::size_t node) const { return _parent[node]; }
+
+    // 查询方法
+    std::size_t size() const noexcept { return _parent.size(); }
+};
+
+#endif // HIERARCHY_HPP
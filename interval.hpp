@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include "vec.hpp"
+
+#ifndef INTERVAL_HPP
+#define INTERVAL_HPP
+
+namespace Detail
+{
+    // 向 +inf / -inf 方向移动一个 ulp，用位运算代替切换舍入模式
+    template <std::floating_point T>
+    constexpr T NextUp(T x)
+    {
+        if constexpr (std::same_as<T, float> || std::same_as<T, double>)
+        {
+            using Bits = std::conditional_t<std::same_as<T, float>, std::uint32_t, std::uint64_t>;
+            if (x != x || x == std::numeric_limits<T>::infinity())
+                return x;
+            if (x == 0)
+                return std::numeric_limits<T>::denorm_min();
+            auto bits = std::bit_cast<Bits>(x);
+            bits = (x > 0) ? bits + 1 : bits - 1;
+            return std::bit_cast<T>(bits);
+        }
+        else
+        {
+            return std::nextafter(x, std::numeric_limits<T>::infinity());
+        }
+    }
+
+    template <std::floating_point T>
+    constexpr T NextDown(T x)
+    {
+        return -NextUp(-x);
+    }
+
+    // 区间端点乘积：按区间算术约定 0 * inf = 0，避免 NaN 使 min / max 丢失包络
+    template <std::floating_point T>
+    constexpr T BoundProduct(T a, T b)
+    {
+        return a == 0 || b == 0 ? T(0) : a * b;
+    }
+}
+
+// 区间数：每次运算后向外扩展一个 ulp，保证真值始终落在区间内
+template <std::floating_point T>
+struct Interval final
+{
+private:
+    // 数据
+    T _lo, _hi;
+
+    static constexpr Interval Outward(T lo, T hi)
+    {
+        return Interval(Detail::NextDown(lo), Detail::NextUp(hi));
+    }
+
+public:
+    using interval_type_alias = T;
+
+    // 构造
+    constexpr Interval() : _lo(0), _hi(0) {}
+
+    constexpr Interval(T value) : _lo(value), _hi(value) {}
+
+    constexpr Interval(T lo, T hi) : _lo(lo), _hi(hi)
+    {
+        if (lo > hi)
+        {
+            throw std::runtime_error("Interval lower bound exceeds upper bound");
+        }
+    }
+
+    // 访问
+    constexpr T lo() const noexcept { return _lo; }
+
+    constexpr T hi() const noexcept { return _hi; }
+
+    constexpr T mid() const noexcept { return _lo + (_hi - _lo) / 2; }
+
+    constexpr T width() const noexcept { return _hi - _lo; }
+
+    // 运算
+    constexpr friend Interval operator+(const Interval &lhs, const Interval &rhs)
+    {
+        return Outward(lhs._lo + rhs._lo, lhs._hi + rhs._hi);
+    }
+
+    constexpr friend Interval operator-(const Interval &lhs, const Interval &rhs)
+    {
+        return Outward(lhs._lo - rhs._hi, lhs._hi - rhs._lo);
+    }
+
+    constexpr friend Interval operator*(const Interval &lhs, const Interval &rhs)
+    {
+        T a = Detail::BoundProduct(lhs._lo, rhs._lo), b = Detail::BoundProduct(lhs._lo, rhs._hi);
+        T c = Detail::BoundProduct(lhs._hi, rhs._lo), d = Detail::BoundProduct(lhs._hi, rhs._hi);
+        return Outward(std::min({a, b, c, d}), std::max({a, b, c, d}));
+    }
+
+    constexpr friend Interval operator/(const Interval &lhs, const Interval &rhs)
+    {
+        if (rhs._lo <= 0 && rhs._hi >= 0)
+        {
+            constexpr T inf = std::numeric_limits<T>::infinity();
+            return Interval(-inf, inf);
+        }
+        T a = lhs._lo / rhs._lo, b = lhs._lo / rhs._hi;
+        T c = lhs._hi / rhs._lo, d = lhs._hi / rhs._hi;
+        return Outward(std::min({a, b, c, d}), std::max({a, b, c, d}));
+    }
+
+    constexpr Interval operator-() const
+    {
+        return Interval(-_hi, -_lo);
+    }
+
+    // 复合赋值运算符
+    constexpr Interval &operator+=(const Interval &other) { return *this = *this + other; }
+
+    constexpr Interval &operator-=(const Interval &other) { return *this = *this - other; }
+
+    constexpr Interval &operator*=(const Interval &other) { return *this = *this * other; }
+
+    constexpr Interval &operator/=(const Interval &other) { return *this = *this / other; }
+
+    // 比较操作符：仅当两个区间完全相同时相等
+    constexpr bool operator==(const Interval &other) const = default;
+
+    // 查询方法
+    constexpr bool Contains(T value) const noexcept { return _lo <= value && value <= _hi; }
+
+    constexpr bool IsPositive() const noexcept { return _lo > 0; }
+
+    constexpr bool IsNegative() const noexcept { return _hi < 0; }
+
+    constexpr bool ContainsZero() const noexcept { return Contains(0); }
+
+    static const std::type_info &type() noexcept { return typeid(Interval<T>); }
+
+    static const std::type_info &value_type() noexcept { return typeid(T); }
+};
+
+// 允许 Interval 作为 Vec/Mat 元素
+template <std::floating_point T>
+struct Detail::IsScalarExtension<Interval<T>> : std::true_type
+{
+};
+
+// 平方根：负数部分被截去；区间完全为负时定义域为空，返回 NaN 区间，与 std::sqrt 对负数的行为一致
+template <std::floating_point T>
+Interval<T> sqrt(const Interval<T> &x)
+{
+    using std::sqrt;
+    if (x.hi() < 0)
+        return Interval<T>(std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::quiet_NaN());
+    T lo = x.lo() > 0 ? Detail::NextDown(sqrt(x.lo())) : T(0);
+    return Interval<T>(std::max(lo, T(0)), Detail::NextUp(sqrt(std::max(x.hi(), T(0)))));
+}
+
+// 绝对值
+template <std::floating_point T>
+constexpr Interval<T> abs(const Interval<T> &x)
+{
+    if (x.lo() >= 0)
+        return x;
+    if (x.hi() <= 0)
+        return -x;
+    return Interval<T>(T(0), std::max(-x.lo(), x.hi()));
+}
+
+// 输出运算符
+template <std::floating_point T>
+std::ostream &operator<<(std::ostream &os, const Interval<T> &x)
+{
+    os << "[" << x.lo() << ", " << x.hi() << "]";
+    return os;
+}
+
+// 类型推导申明
+template <std::floating_point T>
+Interval(T, T) -> Interval<T>;
+
+// 常用区间类型
+using Intervalf = Interval<float>;
+using Intervald = Interval<double>;
+
+#endif // INTERVAL_HPP
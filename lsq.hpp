@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include "vec.hpp"
+#include "mat.hpp"
+#include "autodiff.hpp"
+#include "pool.hpp"
+
+#ifndef LSQ_HPP
+#define LSQ_HPP
+
+// 非线性最小二乘选项
+struct LeastSquaresOptions final
+{
+    std::size_t max_iterations = 100;
+    double initial_lambda = 1e-3;
+    double max_lambda = 1e16;
+    double gradient_tolerance = 1e-10;
+    double step_tolerance = 1e-12;
+    double cost_tolerance = 1e-14;
+};
+
+// 非线性最小二乘结果
+template <std::floating_point T>
+struct LeastSquaresResult final
+{
+    T cost = 0;
+    std::size_t iterations = 0;
+    bool converged = false;
+};
+
+namespace Detail
+{
+    // 用前向模式对偶数求残差及其雅可比矩阵
+    template <std::floating_point T, std::size_t P, typename F>
+    auto AutoJacobian(F &f)
+    {
+        return [&f](const Vec<T, P> &x)
+        { return Jacobian(f, x); };
+    }
+
+    template <std::floating_point T, std::size_t R>
+    T HalfSquaredNorm(const Vec<T, R> &r)
+    {
+        return Dot(r, r) / 2;
+    }
+
+    // 阻尼高斯-牛顿主循环；lambda 为 0 且 damped 为 false 时退化为纯高斯-牛顿
+    template <std::floating_point T, std::size_t P, typename F, typename J>
+    LeastSquaresResult<T> SolveLeastSquares(F &residual, J &jacobian, Vec<T, P> &x, const LeastSquaresOptions &options, bool damped)
+    {
+        auto r = residual(x);
+        LeastSquaresResult<T> result;
+        result.cost = HalfSquaredNorm(r);
+        T lambda = damped ? static_cast<T>(options.initial_lambda) : T(0);
+
+        for (; result.iterations < options.max_iterations; ++result.iterations)
+        {
+            const auto jac = jacobian(x);
+            const auto jt = Transpose(jac);
+            const Mat<T, P, P> jtj = jt * jac;
+            const Vec<T, P> g = jt * r;
+
+            T gmax = 0;
+            for (std::size_t i = 0; i < P; ++i)
+                gmax = std::max(gmax, std::abs(g[i]));
+            if (gmax <= options.gradient_tolerance)
+            {
+                result.converged = true;
+                break;
+            }
+
+            bool accepted = false;
+            while (!accepted)
+            {
+                // Marquardt 缩放：对角线乘以 (1 + lambda)
+                auto a = jtj;
+                for (std::size_t i = 0; i < P; ++i)
+                    a[i, i] += lambda * std::max(jtj[i, i], std::numeric_limits<T>::epsilon());
+
+                if (!Detail::CholeskyInPlace(a))
+                {
+                    if (!damped)
+                        throw std::runtime_error("Normal equations are singular.");
+                    lambda = std::max(lambda * 10, std::numeric_limits<T>::epsilon());
+                    if (lambda > options.max_lambda)
+                        return result;
+                    continue;
+                }
+
+                const Vec<T, P> delta = CholeskySolve(a, -g);
+                if (Length(delta) <= options.step_tolerance * (Length(x) + options.step_tolerance))
+                {
+                    result.converged = true;
+                    return result;
+                }
+
+                const Vec<T, P> candidate = x + delta;
+                const auto rc = residual(candidate);
+                const T cost = HalfSquaredNorm(rc);
+
+                if (!damped || cost < result.cost)
+                {
+                    const T decrease = result.cost - cost;
+                    x = candidate;
+                    r = rc;
+                    result.cost = cost;
+                    if (damped)
+                        lambda = std::max(lambda / 10, std::numeric_limits<T>::epsilon());
+                    accepted = true;
+                    if (damped && decrease <= options.cost_tolerance * (cost + options.cost_tolerance))
+                    {
+                        result.converged = true;
+                        ++result.iterations;
+                        return result;
+                    }
+                }
+                else
+                {
+                    // initial_lambda 为 0 时同样要能增大
+                    lambda = std::max(lambda * 10, std::numeric_limits<T>::epsilon());
+                    if (lambda > options.max_lambda)
+                        return result;
+                }
+            }
+        }
+        return result;
+    }
+}
+
+// Levenberg–Marquardt：residual 为 Vec<S, P> -> Vec<S, R> 的泛型函数，雅可比由对偶数自动求得
+template <std::floating_point T, std::size_t P, typename F>
+LeastSquaresResult<T> LevenbergMarquardt(F &&residual, Vec<T, P> &x, const LeastSquaresOptions &options = {})
+{
+    auto jacobian = Detail::AutoJacobian<T, P>(residual);
+    return Detail::SolveLeastSquares<T, P>(residual, jacobian, x, options, true);
+}
+
+// Levenberg–Marquardt：jacobian 为 Vec<T, P> -> Mat<T, R, P> 的解析雅可比
+template <std::floating_point T, std::size_t P, typename F, typename J>
+LeastSquaresResult<T> LevenbergMarquardt(F &&residual, J &&jacobian, Vec<T, P> &x, const LeastSquaresOptions &options = {})
+{
+    return Detail::SolveLeastSquares<T, P>(residual, jacobian, x, options, true);
+}
+
+// 高斯-牛顿：无阻尼，法方程奇异时抛出异常
+template <std::floating_point T, std::size_t P, typename F>
+LeastSquaresResult<T> GaussNewton(F &&residual, Vec<T, P> &x, const LeastSquaresOptions &options = {})
+{
+    auto jacobian = Detail::AutoJacobian<T, P>(residual);
+    return Detail::SolveLeastSquares<T, P>(residual, jacobian, x, options, false);
+}
+
+// 批量 Levenberg–Marquardt：residual(i, x) 描述第 i 个独立问题，结果写入 results
+template <std::floating_point T, std::size_t P, typename F>
+void LevenbergMarquardtBatch(F &&residual, std::span<Vec<T, P>> xs, std::span<LeastSquaresResult<T>> results,
+                             const LeastSquaresOptions &options = {}, ThreadPool &pool = ThreadPool::Default())
+{
+    if (xs.size() != results.size())
+    {
+        throw std::runtime_error("Batch size mismatch");
+    }
+    ParallelFor(pool, 0, xs.size(), 16, [&](std::size_t i)
+                {
+                    auto problem = [&residual, i](const auto &x)
+                    { return residual(i, x); };
+                    results[i] = LevenbergMarquardt(problem, xs[i], options); });
+}
+
+#endif // LSQ_HPP
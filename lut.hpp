@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include "range.hpp"
+
+#ifndef LUT_HPP
+#define LUT_HPP
+
+// 查表误差报告
+template <std::floating_point T>
+struct LookupError final
+{
+    T max_abs = 0;
+    T max_rel = 0;
+    T worst_x = 0;
+};
+
+// 等距采样查找表：N 个样本覆盖 [start, start + (N - 1) * step]，区间外按端点截断
+template <std::floating_point T, std::size_t N>
+struct LookupTable final
+{
+    static_assert(N >= 2, "LookupTable needs at least two samples");
+
+private:
+    // 数据
+    std::array<T, N> _values;
+    T _start, _step, _inv_step;
+
+    // 把 x 映射为样本下标与区间内的小数部分；x 为 NaN 时下标取 0、frac 为 NaN，插值结果因此为 NaN
+    constexpr void Locate(T x, std::size_t &i, T &frac) const
+    {
+        const T u = (x - _start) * _inv_step;
+        // NaN 不满足 u > 0，先落到 0，保证转换为整数前一定在 [0, N - 1] 内
+        const T c = std::min(u > T(0) ? u : T(0), static_cast<T>(N - 1));
+        std::size_t k = static_cast<std::size_t>(c);
+        if (k > N - 2)
+            k = N - 2;
+        i = k;
+        frac = (u == u ? c : u) - static_cast<T>(k);
+    }
+
+public:
+    // 构造
+    constexpr LookupTable(const std::array<T, N> &values, T start, T step)
+        : _values(values), _start(start), _step(step), _inv_step(T(1) / step)
+    {
+        if (step <= 0)
+        {
+            throw std::runtime_error("LookupTable step must be positive");
+        }
+    }
+
+    // 编译期生成：在 scale * StaticRange 的各点上对 f 采样
+    template <int Start, int End, int Step, typename F>
+    static consteval LookupTable FromStaticRange(StaticRange<Start, End, Step>, F f, T scale = T(1))
+    {
+        static_assert(StaticRange<Start, End, Step>::size == static_cast<int>(N), "StaticRange size must equal N");
+        static_assert(Step > 0, "LookupTable requires an increasing range");
+        std::array<T, N> values{};
+        std::size_t i = 0;
+        for (auto idx : StaticRange<Start, End, Step>{})
+            values[i++] = static_cast<T>(f(static_cast<T>(idx) * scale));
+        return LookupTable(values, static_cast<T>(Start) * scale, static_cast<T>(Step) * scale);
+    }
+
+    // 运行期生成：在 Range 的前 N 个点上对 f 采样
+    template <typename U, typename F>
+    static LookupTable FromRange(const Range<U> &range, F f)
+    {
+        if (range.size() < N)
+        {
+            throw std::runtime_error("Range has fewer samples than the table");
+        }
+        std::array<T, N> values;
+        for (std::size_t i = 0; i < N; ++i)
+            values[i] = static_cast<T>(f(static_cast<T>(range[i])));
+        return LookupTable(values, static_cast<T>(range.start()), static_cast<T>(range.step()));
+    }
+
+    // 线性插值
+    constexpr T Linear(T x) const
+    {
+        std::size_t i;
+        T f;
+        Locate(x, i, f);
+        return _values[i] + f * (_values[i + 1] - _values[i]);
+    }
+
+    // 三次插值（Catmull-Rom，端点处线性外推虚拟样本）
+    constexpr T Cubic(T x) const
+    {
+        std::size_t i;
+        T f;
+        Locate(x, i, f);
+        const T p1 = _values[i];
+        const T p2 = _values[i + 1];
+        const T p0 = i == 0 ? T(2) * p1 - p2 : _values[i - 1];
+        const T p3 = i + 2 < N ? _values[i + 2] : T(2) * p2 - p1;
+        const T a = -p0 / 2 + T(1.5) * p1 - T(1.5) * p2 + p3 / 2;
+        const T b = p0 - T(2.5) * p1 + T(2) * p2 - p3 / 2;
+        const T c = (p2 - p0) / 2;
+        return ((a * f + b) * f + c) * f + p1;
+    }
+
+    // 批量查表：循环体无分支，便于编译器向量化
+    void Linear(std::span<const T> xs, std::span<T> out) const
+    {
+        if (xs.size() != out.size())
+        {
+            throw std::runtime_error("LookupTable span size mismatch");
+        }
+        for (std::size_t k = 0; k < xs.size(); ++k)
+            out[k] = Linear(xs[k]);
+    }
+
+    void Cubic(std::span<const T> xs, std::span<T> out) const
+    {
+        if (xs.size() != out.size())
+        {
+            throw std::runtime_error("LookupTable span size mismatch");
+        }
+        for (std::size_t k = 0; k < xs.size(); ++k)
+            out[k] = Cubic(xs[k]);
+    }
+
+    // 误差报告：每个采样区间内取 samples_per_cell 个点与 f 比较
+    template <typename F>
+    LookupError<T> MeasureError(F f, bool cubic = false, std::size_t samples_per_cell = 8) const
+    {
+        LookupError<T> error;
+        const std::size_t total = (N - 1) * samples_per_cell;
+        for (std::size_t k = 0; k <= total; ++k)
+        {
+            const T x = _start + _step * static_cast<T>(k) / static_cast<T>(samples_per_cell);
+            const T exact = static_cast<T>(f(x));
+            const T approx = cubic ? Cubic(x) : Linear(x);
+            const T abs_err = std::abs(approx - exact);
+            const T rel_err = exact != 0 ? abs_err / std::abs(exact) : abs_err;
+            if (abs_err > error.max_abs)
+            {
+                error.max_abs = abs_err;
+                error.worst_x = x;
+            }
+            error.max_rel = std::max(error.max_rel, rel_err);
+        }
+        return error;
+    }
+
+    // 访问
+    constexpr const T &operator[](std::size_t index) const { return _values[index]; }
+
+    constexpr T start() const noexcept { return _start; }
+
+    constexpr T step() const noexcept { return _step; }
+
+    // 查询方法
+    static constexpr std::size_t size() noexcept { return N; }
+
+    static constexpr std::size_t size_in_bytes() noexcept { return N * sizeof(T); }
+};
+
+#endif // LUT_HPP
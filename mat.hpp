@@ -2,9 +2,14 @@
 #include <concepts>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
 #include <variant>
 #include "vec.hpp"
 #include "range.hpp"
+#include "policy.hpp"
+#include "trace.hpp"
 
 #ifndef MAT_HPP
 #define MAT_HPP
@@ -12,7 +17,7 @@
 namespace Detail 
 {
     template <typename T>
-    concept NumericMat = std::is_arithmetic_v<T>;
+    concept NumericMat = std::is_arithmetic_v<T> || IsScalarExtension<T>::value;
 
     // 多维initlist构造行数据
     template <Detail::NumericMat T, size_t Col>
@@ -40,6 +45,24 @@ namespace Detail
             }
         }
     };
+
+    // 矩阵乘法内核：out(Row x OtherCol) = lhs(Row x Col) * rhs(Col x OtherCol)，按行主序平铺访问
+    template <typename P, typename R, size_t Row, size_t Col, size_t OtherCol, typename Out, typename L, typename Rhs>
+    constexpr void MatMulKernel(Out &out, const L &lhs, const Rhs &rhs)
+    {
+        for (size_t r = 0; r < Row; ++r)
+        {
+            for (size_t c = 0; c < OtherCol; ++c)
+            {
+                out[r * OtherCol + c] = Detail::Reduce<P, R>(
+                    Col,
+                    [&](size_t k)
+                    { return static_cast<R>(lhs[r * Col + k]); },
+                    [&](size_t k)
+                    { return static_cast<R>(rhs[k * OtherCol + c]); });
+            }
+        }
+    }
 };
 
 template <Detail::NumericMat T, size_t Row, size_t Col>
@@ -392,20 +415,10 @@ public:
     template <Detail::NumericMat U, size_t OtherCol>
     constexpr friend auto operator*(const Mat<T, Row, Col> &lhs, const Mat<U, Col, OtherCol> &rhs)
     {
+        RMATH_TRACE_SCOPE("Mat::operator*");
         using ResultType = std::common_type_t<T, U>;
         Mat<ResultType, Row, OtherCol> result;
-        for (size_t r = 0; r < Row; ++r)
-        {
-            for (size_t c = 0; c < OtherCol; ++c)
-            {
-                ResultType sum = 0;
-                for (size_t k = 0; k < Col; ++k)
-                {
-                    sum += static_cast<ResultType>(lhs[r * Col + k]) * static_cast<ResultType>(rhs[k * OtherCol + c]);
-                }
-                result[r * OtherCol + c] = sum;
-            }
-        }
+        Detail::MatMulKernel<DefaultPolicy, ResultType, Row, Col, OtherCol>(result, lhs, rhs);
         return result;
     }
 
@@ -442,15 +455,7 @@ public:
     {
         using ResultType = std::common_type_t<T, U>;
         Vec<ResultType, Row> result;
-        for (size_t r = 0; r < Row; ++r)
-        {
-            ResultType sum = 0;
-            for (size_t c = 0; c < Col; ++c)
-            {
-                sum += static_cast<ResultType>(lhs[r * Col + c]) * static_cast<ResultType>(rhs[c]);
-            }
-            result[r] = sum;
-        }
+        Detail::MatMulKernel<DefaultPolicy, ResultType, Row, Col, 1>(result, lhs, rhs);
         return result;
     }
 
@@ -459,15 +464,7 @@ public:
     {
         using ResultType = std::common_type_t<T, U>;
         Vec<ResultType, Col> result;
-        for (size_t c = 0; c < Col; ++c)
-        {
-            ResultType sum = 0;
-            for (size_t r = 0; r < Row; ++r)
-            {
-                sum += static_cast<ResultType>(lhs[r]) * static_cast<ResultType>(rhs[r * Col + c]);
-            }
-            result[c] = sum;
-        }
+        Detail::MatMulKernel<DefaultPolicy, ResultType, 1, Row, Col>(result, lhs, rhs);
         return result;
     }
 
@@ -525,18 +522,7 @@ public:
         static_assert(Row == Col, "operator*= is only supported for square matrices to maintain dimensions.");
 
         Mat<T, Row, Col> temp;
-        for (size_t r = 0; r < Row; ++r)
-        {
-            for (size_t c = 0; c < Col; ++c)
-            {
-                T sum = 0;
-                for (size_t k = 0; k < Col; ++k)
-                {
-                    sum += (*this)[r, k] * static_cast<T>(rhs[k, c]);
-                }
-                temp[r, c] = sum;
-            }
-        }
+        Detail::MatMulKernel<DefaultPolicy, T, Row, Col, Col>(temp, *this, rhs);
         *this = temp;
         return *this;
     }
@@ -579,19 +565,65 @@ template <Detail::NumericMat T,Detail::NumericMat U, size_t N>
     constexpr auto &operator*=(Vec<U, N> &lhs, const Mat<T, N, N> &rhs)
     {
         Vec<T, N> temp;
-        for (size_t c = 0; c < N; ++c)
-        {
-            T sum = 0;
-            for (size_t r = 0; r < N; ++r)
-            {
-                sum += (lhs)[r] * static_cast<T>(rhs[r, c]);
-            }
-            temp[c] = sum;
-        }
+        Detail::MatMulKernel<DefaultPolicy, T, 1, N, N>(temp, lhs, rhs);
         lhs = temp;
         return lhs;
     }
 
+// 按策略的矩阵乘法
+template <Detail::FloatPolicy P, Detail::NumericMat T, Detail::NumericMat U, size_t Row, size_t Col, size_t OtherCol>
+constexpr auto Multiply(P, const Mat<T, Row, Col> &lhs, const Mat<U, Col, OtherCol> &rhs)
+{
+    using ResultType = std::common_type_t<T, U>;
+    Mat<ResultType, Row, OtherCol> result;
+    Detail::MatMulKernel<P, ResultType, Row, Col, OtherCol>(result, lhs, rhs);
+    return result;
+}
+
+template <Detail::FloatPolicy P, Detail::NumericMat T, Detail::NumericVec U, size_t Row, size_t Col>
+constexpr auto Multiply(P, const Mat<T, Row, Col> &lhs, const Vec<U, Col> &rhs)
+{
+    using ResultType = std::common_type_t<T, U>;
+    Vec<ResultType, Row> result;
+    Detail::MatMulKernel<P, ResultType, Row, Col, 1>(result, lhs, rhs);
+    return result;
+}
+
+template <Detail::FloatPolicy P, Detail::NumericVec T, Detail::NumericMat U, size_t Row, size_t Col>
+constexpr auto Multiply(P, const Vec<T, Row> &lhs, const Mat<U, Row, Col> &rhs)
+{
+    using ResultType = std::common_type_t<T, U>;
+    Vec<ResultType, Col> result;
+    Detail::MatMulKernel<P, ResultType, 1, Row, Col>(result, lhs, rhs);
+    return result;
+}
+
+// 融合乘加 a * b + c（按元素）
+template <Detail::NumericMat T, Detail::NumericMat U, Detail::NumericMat V, size_t Row, size_t Col>
+constexpr auto MulAdd(const Mat<T, Row, Col> &a, const Mat<U, Row, Col> &b, const Mat<V, Row, Col> &c)
+{
+    using ResultType = std::common_type_t<T, U, V>;
+    Mat<ResultType, Row, Col> result;
+    for (size_t i = 0; i < Row * Col; ++i)
+    {
+        result[i] = Detail::MulAdd<DefaultPolicy, ResultType>(static_cast<ResultType>(a[i]), static_cast<ResultType>(b[i]), static_cast<ResultType>(c[i]));
+    }
+    return result;
+}
+
+// 融合乘加 s * a + c（标量乘矩阵）
+template <Detail::NumericMat S, Detail::NumericMat U, Detail::NumericMat V, size_t Row, size_t Col>
+constexpr auto MulAdd(const S &s, const Mat<U, Row, Col> &a, const Mat<V, Row, Col> &c)
+{
+    using ResultType = std::common_type_t<S, U, V>;
+    Mat<ResultType, Row, Col> result;
+    for (size_t i = 0; i < Row * Col; ++i)
+    {
+        result[i] = Detail::MulAdd<DefaultPolicy, ResultType>(static_cast<ResultType>(s), static_cast<ResultType>(a[i]), static_cast<ResultType>(c[i]));
+    }
+    return result;
+}
+
 // 矩阵 Hadamard 积
 template <typename... Args>
     requires(sizeof...(Args) >= 2) &&
@@ -702,37 +734,178 @@ constexpr auto MinorMatrix(const Mat<T, Row, Col> &mat, size_t omitRow, size_t o
     return result;
 }
 
-// 行列式取值
-template <Detail::NumericMat T, size_t Size>
-constexpr auto Det(const Mat<T, Size, Size> &mat)
+namespace Detail
 {
-    if constexpr (Size == 1)
+    // 整数行列式的中间类型：32 位及以下用 int64，64 位在支持时用 __int128
+#ifdef __SIZEOF_INT128__
+    template <typename T>
+    using WideInt = std::conditional_t<(sizeof(T) <= 4), std::int64_t, __int128>;
+#else
+    template <typename T>
+    using WideInt = std::int64_t;
+#endif
+
+    // 与 W 同宽的无符号类型，用于不检查溢出时的回绕运算
+    template <typename W>
+#ifdef __SIZEOF_INT128__
+    using WideUInt = std::conditional_t<(sizeof(W) <= 8), std::uint64_t, unsigned __int128>;
+#else
+    using WideUInt = std::uint64_t;
+#endif
+
+    // a * b - c * d，按 2 的补码回绕（有符号溢出是未定义行为，这里先在无符号类型中计算）
+    template <typename W>
+    constexpr W WrapMulSub(W a, W b, W c, W d)
     {
-        return mat[0];
+        using U = WideUInt<W>;
+        return static_cast<W>(static_cast<U>(a) * static_cast<U>(b) - static_cast<U>(c) * static_cast<U>(d));
     }
-    else if constexpr (Size == 2)
+
+    // 回绕除法：唯一会溢出的情形是 min / -1
+    template <typename W>
+    constexpr W WrapDiv(W a, W b)
     {
-        return mat[0, 0] * mat[1, 1] - mat[0, 1] * mat[1, 0];
+        if (b == -1)
+            return static_cast<W>(WideUInt<W>(0) - static_cast<WideUInt<W>>(a));
+        return a / b;
     }
-    else
+
+    template <typename W>
+    constexpr W CheckedMul(W a, W b)
     {
-        auto det = static_cast<T>(0);
-        int sign = 1;
-        // 沿第一行展开
-        for (size_t j = 0; j < Size; ++j)
+        W result{};
+#if defined(__GNUC__)
+        if (__builtin_mul_overflow(a, b, &result))
+            throw std::overflow_error("Integer overflow in determinant.");
+#else
+        if (a != 0 && (b > std::numeric_limits<W>::max() / (a < 0 ? -a : a) || b < std::numeric_limits<W>::min() / (a < 0 ? -a : a)))
+            throw std::overflow_error("Integer overflow in determinant.");
+        result = a * b;
+#endif
+        return result;
+    }
+
+    template <typename W>
+    constexpr W CheckedSub(W a, W b)
+    {
+        W result{};
+#if defined(__GNUC__)
+        if (__builtin_sub_overflow(a, b, &result))
+            throw std::overflow_error("Integer overflow in determinant.");
+#else
+        if ((b < 0 && a > std::numeric_limits<W>::max() + b) || (b > 0 && a < std::numeric_limits<W>::min() + b))
+            throw std::overflow_error("Integer overflow in determinant.");
+        result = a - b;
+#endif
+        return result;
+    }
+
+    // Bareiss 无分数消元：每步的除法都是整除，中间值均为原矩阵的子式，
+    // 在 WideInt 中计算；Checked 为 true 时任何溢出（含结果超出 T）都抛出 std::overflow_error，
+    // 为 false 时按 2 的补码回绕：行为确定（常量求值中也不报错），但一旦溢出结果就没有意义
+    template <bool Checked, typename T, size_t Size>
+    constexpr T BareissDet(const Mat<T, Size, Size> &mat)
+    {
+        using W = WideInt<T>;
+        std::array<W, Size * Size> m{};
+        for (size_t i = 0; i < Size * Size; ++i)
+            m[i] = static_cast<W>(mat[i]);
+
+        W sign = 1, prev = 1;
+        for (size_t k = 0; k + 1 < Size; ++k)
+        {
+            if (m[k * Size + k] == 0)
+            {
+                size_t pivot = k + 1;
+                while (pivot < Size && m[pivot * Size + k] == 0)
+                    ++pivot;
+                if (pivot == Size)
+                    return static_cast<T>(0);
+                for (size_t j = 0; j < Size; ++j)
+                    std::swap(m[k * Size + j], m[pivot * Size + j]);
+                sign = -sign;
+            }
+            const W diag = m[k * Size + k];
+            for (size_t i = k + 1; i < Size; ++i)
+            {
+                for (size_t j = k + 1; j < Size; ++j)
+                {
+                    W &target = m[i * Size + j];
+                    if constexpr (Checked)
+                        target = CheckedSub(CheckedMul(target, diag), CheckedMul(m[i * Size + k], m[k * Size + j])) / prev;
+                    else
+                        target = WrapDiv(WrapMulSub(target, diag, m[i * Size + k], m[k * Size + j]), prev);
+                }
+                m[i * Size + k] = 0;
+            }
+            prev = diag;
+        }
+
+        const W det = sign > 0 ? m[Size * Size - 1] : WrapMulSub(W(0), W(0), W(1), m[Size * Size - 1]);
+        if constexpr (Checked)
         {
-            det += sign * mat[0, j] * Det(MinorMatrix(mat, 0, j));
-            sign = -sign;
+            if (det < static_cast<W>(std::numeric_limits<T>::min()) || det > static_cast<W>(std::numeric_limits<T>::max()))
+                throw std::overflow_error("Determinant does not fit in the element type.");
+        }
+        return static_cast<T>(det);
+    }
+
+    // 余子式展开的递归不经过 Det，避免每个子式都产生追踪事件
+    template <NumericMat T, size_t Size>
+    constexpr auto DetValue(const Mat<T, Size, Size> &mat)
+    {
+        if constexpr (Size == 1)
+        {
+            return mat[0];
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            return BareissDet<false>(mat);
+        }
+        else if constexpr (Size == 2)
+        {
+            return mat[0, 0] * mat[1, 1] - mat[0, 1] * mat[1, 0];
+        }
+        else
+        {
+            auto det = static_cast<T>(0);
+            int sign = 1;
+            // 沿第一行展开
+            for (size_t j = 0; j < Size; ++j)
+            {
+                det += sign * mat[0, j] * DetValue(MinorMatrix(mat, 0, j));
+                sign = -sign;
+            }
+            return det;
         }
-        return det;
     }
 }
 
+// 行列式取值（整数矩阵走 Bareiss 消元，中间子式不超出 WideInt、结果在 T 范围内时精确；
+// 不检查溢出：溢出时运算按 2 的补码回绕，行为确定但结果没有意义，常量求值中同样静默得到错误值。
+// 需要检测溢出请用 DetChecked：运行期抛出 std::overflow_error，常量求值中溢出则是编译错误）
+template <Detail::NumericMat T, size_t Size>
+constexpr auto Det(const Mat<T, Size, Size> &mat)
+{
+    RMATH_TRACE_SCOPE("Det");
+    return Detail::DetValue(mat);
+}
+
+// 带溢出检查的整数行列式：中间值或结果溢出时抛出 std::overflow_error（常量求值中即编译错误）
+template <std::integral T, size_t Size>
+constexpr T DetChecked(const Mat<T, Size, Size> &mat)
+{
+    if constexpr (Size == 1)
+        return mat[0];
+    else
+        return Detail::BareissDet<true>(mat);
+}
+
 // --- 代数余子式 (Cofactor) ---
 template <Detail::NumericMat T, size_t Size>
 constexpr auto Cofactor(const Mat<T, Size, Size> &mat, size_t row, size_t col)
 {
-    auto minorDet = Det(MinorMatrix(mat, row, col));
+    auto minorDet = Detail::DetValue(MinorMatrix(mat, row, col));
     return ((row + col) % 2 == 0) ? minorDet : -minorDet;
 }
 
@@ -755,17 +928,378 @@ constexpr auto Adjoint(const Mat<T, Size, Size> &mat)
     return adj;
 }
 
-// 逆矩阵
+// LU 分解结果：P * A = L * U，L 的单位下三角部分与 U 合存于 lu，perm[i] 为 P * A 第 i 行在 A 中的行号
+template <std::floating_point T, size_t Size>
+struct LUResult final
+{
+    Mat<T, Size, Size> lu;
+    std::array<size_t, Size> perm{};
+    int sign = 1;
+    // 最小与最大主元绝对值之比，越接近 0 越接近奇异
+    T pivot_ratio = 0;
+    // 存在 |u_kk| <= pivot_tolerance * max|a_ij| 的主元
+    bool singular = false;
+};
+
+// 逆矩阵诊断：不抛出异常，ok 为 false 时 inverse 无意义
+template <std::floating_point T, size_t Size>
+struct InverseResult final
+{
+    Mat<T, Size, Size> inverse;
+    bool ok = false;
+    T pivot_ratio = 0;
+    // 1-范数条件数 ||A||_1 * ||A^-1||_1（由算出的逆矩阵直接求得），奇异时为 infinity
+    T condition = std::numeric_limits<T>::infinity();
+};
+
+namespace Detail
+{
+    // 默认相对主元阈值：Size * epsilon，与矩阵整体缩放无关
+    template <std::floating_point T, size_t Size>
+    constexpr T DefaultPivotTolerance()
+    {
+        return static_cast<T>(Size) * std::numeric_limits<T>::epsilon();
+    }
+
+    template <std::floating_point T, size_t Size>
+    constexpr T NormOne(const Mat<T, Size, Size> &mat)
+    {
+        T norm = 0;
+        for (size_t j = 0; j < Size; ++j)
+        {
+            T sum = 0;
+            for (size_t i = 0; i < Size; ++i)
+                sum += std::abs(mat[i, j]);
+            norm = std::max(norm, sum);
+        }
+        return norm;
+    }
+
+    // 解 A^T * x = b：U^T * w = b，L^T * v = w，x = P^T * v
+    template <std::floating_point T, size_t Size>
+    constexpr Vec<T, Size> LUSolveTransposed(const LUResult<T, Size> &lu, const Vec<T, Size> &b)
+    {
+        Vec<T, Size> v;
+        for (size_t i = 0; i < Size; ++i)
+        {
+            T s = b[i];
+            for (size_t k = 0; k < i; ++k)
+                s -= lu.lu[k, i] * v[k];
+            v[i] = s / lu.lu[i, i];
+        }
+        for (size_t i = Size; i-- > 0;)
+        {
+            T s = v[i];
+            for (size_t k = i + 1; k < Size; ++k)
+                s -= lu.lu[k, i] * v[k];
+            v[i] = s;
+        }
+        Vec<T, Size> x;
+        for (size_t i = 0; i < Size; ++i)
+            x[lu.perm[i]] = v[i];
+        return x;
+    }
+}
+
+// 部分主元 LU 分解：主元相对于 max|a_ij| 不超过 pivot_tolerance 时记为奇异（不抛出异常）
+template <std::floating_point T, size_t Size>
+constexpr LUResult<T, Size> LU(const Mat<T, Size, Size> &mat,
+                               T pivot_tolerance = Detail::DefaultPivotTolerance<T, Size>())
+{
+    LUResult<T, Size> result{mat};
+    auto &a = result.lu;
+    T scale = 0;
+    for (size_t i = 0; i < Size * Size; ++i)
+        scale = std::max(scale, std::abs(a[i]));
+    for (size_t i = 0; i < Size; ++i)
+        result.perm[i] = i;
+
+    T min_pivot = std::numeric_limits<T>::infinity(), max_pivot = 0;
+    for (size_t k = 0; k < Size; ++k)
+    {
+        size_t pivot = k;
+        for (size_t i = k + 1; i < Size; ++i)
+            if (std::abs(a[i, k]) > std::abs(a[pivot, k]))
+                pivot = i;
+        if (pivot != k)
+        {
+            for (size_t j = 0; j < Size; ++j)
+                std::swap(a[k, j], a[pivot, j]);
+            std::swap(result.perm[k], result.perm[pivot]);
+            result.sign = -result.sign;
+        }
+        const T magnitude = std::abs(a[k, k]);
+        min_pivot = std::min(min_pivot, magnitude);
+        max_pivot = std::max(max_pivot, magnitude);
+        if (!(magnitude > pivot_tolerance * scale))
+        {
+            result.singular = true;
+            if (magnitude == 0)
+                continue;
+        }
+        for (size_t i = k + 1; i < Size; ++i)
+        {
+            const T factor = a[i, k] / a[k, k];
+            a[i, k] = factor;
+            for (size_t j = k + 1; j < Size; ++j)
+                a[i, j] -= factor * a[k, j];
+        }
+    }
+    result.pivot_ratio = max_pivot > 0 ? min_pivot / max_pivot : T(0);
+    return result;
+}
+
+// 由 LU 因子解 A * x = b
+template <std::floating_point T, size_t Size>
+constexpr Vec<T, Size> LUSolve(const LUResult<T, Size> &lu, const Vec<T, Size> &b)
+{
+    Vec<T, Size> x;
+    for (size_t i = 0; i < Size; ++i)
+    {
+        T s = b[lu.perm[i]];
+        for (size_t k = 0; k < i; ++k)
+            s -= lu.lu[i, k] * x[k];
+        x[i] = s;
+    }
+    for (size_t i = Size; i-- > 0;)
+    {
+        T s = x[i];
+        for (size_t k = i + 1; k < Size; ++k)
+            s -= lu.lu[i, k] * x[k];
+        x[i] = s / lu.lu[i, i];
+    }
+    return x;
+}
+
+// 1-范数条件数估计（Hager / Higham）：只做若干次 O(n^2) 的三角求解，不构造逆矩阵；
+// 估计值不超过真实条件数，通常相差不到一个数量级。a_norm 为 ||A||_1
+template <std::floating_point T, size_t Size>
+constexpr T EstimateCondition(const LUResult<T, Size> &lu, T a_norm)
+{
+    if (lu.singular)
+        return std::numeric_limits<T>::infinity();
+
+    // 估计 ||A^-1||_1：在单位 1-范数球的顶点上做梯度上升
+    Vec<T, Size> x;
+    for (size_t i = 0; i < Size; ++i)
+        x[i] = T(1) / static_cast<T>(Size);
+    T estimate = 0;
+    size_t last = Size;
+    for (int iteration = 0; iteration < 5; ++iteration)
+    {
+        const Vec<T, Size> y = LUSolve(lu, x);
+        estimate = 0;
+        Vec<T, Size> xi;
+        for (size_t i = 0; i < Size; ++i)
+        {
+            estimate += std::abs(y[i]);
+            xi[i] = y[i] >= 0 ? T(1) : T(-1);
+        }
+        const Vec<T, Size> z = Detail::LUSolveTransposed(lu, xi);
+        size_t j = 0;
+        T ztx = 0;
+        for (size_t i = 0; i < Size; ++i)
+        {
+            ztx += z[i] * x[i];
+            if (std::abs(z[i]) > std::abs(z[j]))
+                j = i;
+        }
+        if (std::abs(z[j]) <= ztx || j == last)
+            break;
+        x = Vec<T, Size>{};
+        x[j] = T(1);
+        last = j;
+    }
+
+    // Higham 的交替符号向量，弥补梯度上升落入局部极大值的情况
+    if constexpr (Size > 1)
+    {
+        Vec<T, Size> b;
+        for (size_t i = 0; i < Size; ++i)
+            b[i] = (i % 2 ? T(-1) : T(1)) * (T(1) + static_cast<T>(i) / static_cast<T>(Size - 1));
+        const Vec<T, Size> y = LUSolve(lu, b);
+        T norm = 0;
+        for (size_t i = 0; i < Size; ++i)
+            norm += std::abs(y[i]);
+        estimate = std::max(estimate, T(2) * norm / (T(3) * static_cast<T>(Size)));
+    }
+    return estimate * a_norm;
+}
+
+template <std::floating_point T, size_t Size>
+constexpr T EstimateCondition(const Mat<T, Size, Size> &mat)
+{
+    return EstimateCondition(LU(mat), Detail::NormOne(mat));
+}
+
+// 带诊断的逆矩阵：主元低于相对阈值，或条件数 * epsilon >= 1（逆矩阵没有一位有效数字）时 ok 为 false。
+// 条件数由算出的逆矩阵直接求 1-范数得到，只多 O(n^2)，不调用 EstimateCondition
+template <std::floating_point T, size_t Size>
+constexpr InverseResult<T, Size> TryInverse(const Mat<T, Size, Size> &mat,
+                                            T pivot_tolerance = Detail::DefaultPivotTolerance<T, Size>())
+{
+    InverseResult<T, Size> result;
+    const auto lu = LU(mat, pivot_tolerance);
+    result.pivot_ratio = lu.pivot_ratio;
+    if (lu.singular)
+        return result;
+    for (size_t j = 0; j < Size; ++j)
+    {
+        Vec<T, Size> e;
+        e[j] = T(1);
+        const Vec<T, Size> column = LUSolve(lu, e);
+        for (size_t i = 0; i < Size; ++i)
+            result.inverse[i, j] = column[i];
+    }
+    result.condition = Detail::NormOne(mat) * Detail::NormOne(result.inverse);
+    // 取反比较：条件数为 NaN 时同样判为失败
+    result.ok = result.condition * std::numeric_limits<T>::epsilon() < T(1);
+    return result;
+}
+
+namespace Detail
+{
+    // 带值的扩展标量（Dual、Var）：value() 为浮点数，运算的值部分与普通浮点运算相同
+    template <typename T>
+    concept ValuedScalar = requires(const T &x) {
+        { x.value() } -> std::floating_point;
+    };
+
+    // 伴随矩阵求逆的奇异判定（值部分）：各行先除以其 2-范数，再看行列式是否不超过 Size * epsilon。
+    // 由 Hadamard 不等式，规范化后的 |det| <= 1，且与各行的缩放无关
+    template <ValuedScalar T, size_t Size>
+    bool AdjointSingular(const Mat<T, Size, Size> &mat)
+    {
+        using V = std::remove_cvref_t<decltype(mat[0].value())>;
+        Mat<V, Size, Size> normalized;
+        for (size_t i = 0; i < Size; ++i)
+        {
+            V norm = 0;
+            for (size_t j = 0; j < Size; ++j)
+                norm = std::hypot(norm, mat[i, j].value());
+            if (!(norm > 0))
+                return true;
+            for (size_t j = 0; j < Size; ++j)
+                normalized[i, j] = mat[i, j].value() / norm;
+        }
+        return !(std::abs(DetValue(normalized)) > static_cast<V>(Size) * std::numeric_limits<V>::epsilon());
+    }
+}
+
+// 逆矩阵（整数矩阵由精确的伴随矩阵与行列式得到 double 结果，避免整数除法截断；
+// 浮点矩阵用部分主元 LU，主元低于相对阈值或条件数 * epsilon >= 1 时视为奇异并抛出异常，与矩阵缩放无关；
+// Interval 用伴随矩阵除以行列式，行列式区间含 0 时抛出异常；
+// Dual、Var 等带值的扩展标量用伴随矩阵除以行列式，按值部分做与行缩放无关的奇异判定）
 template <Detail::NumericMat T, size_t Size>
 constexpr auto Inverse(const Mat<T, Size, Size> &mat)
 {
-    auto det = Det(mat);
-    
-    if (std::abs(det) < 1e-9)
+    RMATH_TRACE_SCOPE("Inverse");
+    if constexpr (std::is_integral_v<T>)
+    {
+        auto det = Det(mat);
+        if (det == 0)
+        {
+            throw std::runtime_error("Matrix is singular and cannot be inverted.");
+        }
+        return Mat<double, Size, Size>(Adjoint(mat)) * (1.0 / static_cast<double>(det));
+    }
+    else if constexpr (std::floating_point<T>)
+    {
+        auto result = TryInverse(mat);
+        if (!result.ok)
+        {
+            throw std::runtime_error("Matrix is singular and cannot be inverted.");
+        }
+        return result.inverse;
+    }
+    else if constexpr (requires(const T &x) { { x.ContainsZero() } -> std::convertible_to<bool>; })
+    {
+        // 区间等包络型标量：行列式区间含 0 即可能奇异
+        const auto det = Det(mat);
+        if (det.ContainsZero())
+        {
+            throw std::runtime_error("Matrix may be singular: determinant encloses zero.");
+        }
+        return Adjoint(mat) * (static_cast<T>(1) / det);
+    }
+    else if constexpr (Detail::ValuedScalar<T>)
+    {
+        if (Detail::AdjointSingular(mat))
+        {
+            throw std::runtime_error("Matrix is singular and cannot be inverted.");
+        }
+        return Adjoint(mat) * (static_cast<T>(1) / Det(mat));
+    }
+    else
     {
-        throw std::runtime_error("Matrix is singular and cannot be inverted.");
+        // 其余扩展标量无法判定奇异
+        static_assert(Detail::ValuedScalar<T>, "Inverse does not support this element type.");
     }
-    return Adjoint(mat) * (static_cast<T>(1) / det);
+}
+
+namespace Detail
+{
+    // 原地 Cholesky 分解：成功时下三角部分为 L，非正定时返回 false
+    template <Detail::NumericMat T, size_t Size>
+    constexpr bool CholeskyInPlace(Mat<T, Size, Size> &a)
+    {
+        using std::sqrt;
+        for (size_t j = 0; j < Size; ++j)
+        {
+            T d = a[j, j];
+            for (size_t k = 0; k < j; ++k)
+                d -= a[j, k] * a[j, k];
+            if (!(d > 0))
+                return false;
+            d = sqrt(d);
+            a[j, j] = d;
+            for (size_t i = j + 1; i < Size; ++i)
+            {
+                T s = a[i, j];
+                for (size_t k = 0; k < j; ++k)
+                    s -= a[i, k] * a[j, k];
+                a[i, j] = s / d;
+            }
+            for (size_t i = 0; i < j; ++i)
+                a[i, j] = 0;
+        }
+        return true;
+    }
+}
+
+// Cholesky 分解：A = L * L^T，A 须对称正定
+template <Detail::NumericMat T, size_t Size>
+constexpr auto Cholesky(const Mat<T, Size, Size> &mat)
+{
+    auto l = mat;
+    if (!Detail::CholeskyInPlace(l))
+    {
+        throw std::runtime_error("Matrix is not positive definite.");
+    }
+    return l;
+}
+
+// 由 Cholesky 因子 L 解 L * L^T * x = b
+template <Detail::NumericMat T, Detail::NumericVec U, size_t Size>
+constexpr auto CholeskySolve(const Mat<T, Size, Size> &l, const Vec<U, Size> &b)
+{
+    using ResultType = std::common_type_t<T, U>;
+    Vec<ResultType, Size> x;
+    for (size_t i = 0; i < Size; ++i)
+    {
+        ResultType s = static_cast<ResultType>(b[i]);
+        for (size_t k = 0; k < i; ++k)
+            s -= static_cast<ResultType>(l[i, k]) * x[k];
+        x[i] = s / static_cast<ResultType>(l[i, i]);
+    }
+    for (size_t i = Size; i-- > 0;)
+    {
+        ResultType s = x[i];
+        for (size_t k = i + 1; k < Size; ++k)
+            s -= static_cast<ResultType>(l[k, i]) * x[k];
+        x[i] = s / static_cast<ResultType>(l[i, i]);
+    }
+    return x;
 }
 
 // 矩阵的迹
@@ -780,13 +1314,30 @@ constexpr auto Trace(const Mat<T, Size, Size> &mat)
     return trace;
 }
 
+// 矩阵幂：反复平方，共 O(log exponent) 次矩阵乘法
+template <Detail::NumericMat T, size_t Size>
+constexpr Mat<T, Size, Size> MatPow(Mat<T, Size, Size> base, std::uint64_t exponent)
+{
+    auto result = Mat<T, Size, Size>::MakeIdentity();
+    while (exponent)
+    {
+        if (exponent & 1)
+            result = result * base;
+        exponent >>= 1;
+        if (exponent)
+            base = base * base;
+    }
+    return result;
+}
+
 // 矩阵的秩
 template <Detail::NumericMat T, size_t Row, size_t Col>
 constexpr size_t Rank(const Mat<T, Row, Col> &mat)
 {
+    RMATH_TRACE_SCOPE("Rank");
     auto temp = mat;
     size_t rank = 0;
-    std::vector<bool> row_used(Row, false);
+    std::array<bool, Row> row_used{};
 
     for (size_t i = 0; i < Col && rank < Row; ++i)
     {
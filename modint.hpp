@@ -0,0 +1,247 @@
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "vec.hpp"
+#include "mat.hpp"
+
+#ifndef MODINT_HPP
+#define MODINT_HPP
+
+// 模 P 整数（P 为小于 2^31 的奇数，不要求素数）：内部以 Montgomery 形式 x * 2^32 mod P 存放，
+// 乘法只需一次 64 位乘法与一次约简，不做除法。P 为合数时只有与 P 互素的元素可逆
+template <std::uint32_t P>
+struct ModInt final
+{
+    static_assert(P % 2 == 1 && P < (1u << 31), "ModInt modulus must be an odd number below 2^31");
+
+private:
+    // 数据
+    std::uint32_t _value = 0;
+
+    // -P^-1 mod 2^32（牛顿迭代，每次精度翻倍）
+    static constexpr std::uint32_t NegInv = []
+    {
+        std::uint32_t inv = P;
+        for (int i = 0; i < 5; ++i)
+            inv *= 2u - P * inv;
+        return 0u - inv;
+    }();
+
+    // 2^64 mod P，用于转入 Montgomery 形式
+    static constexpr std::uint32_t R2 = []
+    {
+        const std::uint64_t r = (std::uint64_t(1) << 32) % P;
+        return static_cast<std::uint32_t>(r * r % P);
+    }();
+
+    // t * 2^-32 mod P，要求 t < P * 2^32
+    static constexpr std::uint32_t Reduce(std::uint64_t t)
+    {
+        const std::uint32_t m = static_cast<std::uint32_t>(t) * NegInv;
+        std::uint32_t u = static_cast<std::uint32_t>((t + std::uint64_t(m) * P) >> 32);
+        return u >= P ? u - P : u;
+    }
+
+    struct RawTag
+    {
+    };
+
+    constexpr ModInt(std::uint32_t raw, RawTag) : _value(raw) {}
+
+public:
+    // 构造
+    constexpr ModInt() = default;
+
+    template <std::integral I>
+    constexpr ModInt(I x)
+    {
+        std::int64_t r = static_cast<std::int64_t>(x % static_cast<std::int64_t>(P));
+        if (r < 0)
+            r += P;
+        _value = Reduce(static_cast<std::uint64_t>(r) * R2);
+    }
+
+    // 访问
+    constexpr std::uint32_t value() const { return Reduce(_value); }
+
+    static constexpr std::uint32_t modulus() noexcept { return P; }
+
+    // 查询方法：gcd(value, P) == 1 时可逆
+    constexpr bool invertible() const { return std::gcd(value(), P) == 1; }
+
+    // 运算
+    constexpr ModInt &operator+=(const ModInt &other)
+    {
+        _value += other._value;
+        if (_value >= P)
+            _value -= P;
+        return *this;
+    }
+
+    constexpr ModInt &operator-=(const ModInt &other)
+    {
+        _value = _value >= other._value ? _value - other._value : _value + P - other._value;
+        return *this;
+    }
+
+    constexpr ModInt &operator*=(const ModInt &other)
+    {
+        _value = Reduce(std::uint64_t(_value) * other._value);
+        return *this;
+    }
+
+    constexpr ModInt &operator/=(const ModInt &other) { return *this *= other.Inverse(); }
+
+    constexpr ModInt operator-() const { return ModInt(_value == 0 ? 0 : P - _value, RawTag{}); }
+
+    friend constexpr ModInt operator+(ModInt lhs, const ModInt &rhs) { return lhs += rhs; }
+
+    friend constexpr ModInt operator-(ModInt lhs, const ModInt &rhs) { return lhs -= rhs; }
+
+    friend constexpr ModInt operator*(ModInt lhs, const ModInt &rhs) { return lhs *= rhs; }
+
+    friend constexpr ModInt operator/(ModInt lhs, const ModInt &rhs) { return lhs /= rhs; }
+
+    friend constexpr bool operator==(const ModInt &lhs, const ModInt &rhs) { return lhs._value == rhs._value; }
+
+    constexpr ModInt Pow(std::uint64_t exponent) const
+    {
+        ModInt result(1), base = *this;
+        while (exponent)
+        {
+            if (exponent & 1)
+                result *= base;
+            base *= base;
+            exponent >>= 1;
+        }
+        return result;
+    }
+
+    // 乘法逆元（扩展欧几里得，P 可为合数）：gcd(value, P) != 1 时抛出异常
+    constexpr ModInt Inverse() const
+    {
+        std::int64_t a = value(), b = P, x = 1, y = 0;
+        while (b != 0)
+        {
+            const std::int64_t q = a / b;
+            a = std::exchange(b, a - q * b);
+            x = std::exchange(y, x - q * y);
+        }
+        if (a != 1)
+        {
+            throw std::runtime_error("Element has no inverse modulo P.");
+        }
+        return ModInt(x);
+    }
+
+    // 输出运算符
+    friend std::ostream &operator<<(std::ostream &os, const ModInt &x) { return os << x.value(); }
+};
+
+namespace Detail
+{
+    template <std::uint32_t P>
+    struct IsScalarExtension<ModInt<P>> : std::true_type
+    {
+    };
+}
+
+namespace Detail
+{
+    // 第 k 列中自第 k 行起的主元：优先取可逆元素；只剩零因子时抛出异常（P 为合数时消元无法继续），
+    // 全为零时返回 Size
+    template <std::uint32_t P, size_t Size>
+    constexpr size_t ModPivot(const Mat<ModInt<P>, Size, Size> &a, size_t k)
+    {
+        bool zero_divisor = false;
+        for (size_t i = k; i < Size; ++i)
+        {
+            if (a[i, k].invertible())
+                return i;
+            zero_divisor = zero_divisor || a[i, k] != ModInt<P>(0);
+        }
+        if (zero_divisor)
+        {
+            throw std::runtime_error("Elimination modulo P needs an invertible pivot.");
+        }
+        return Size;
+    }
+}
+
+// 模 P 行列式：高斯消元，O(n^3)。P 为素数时总能完成；P 为合数且某列只剩零因子主元时抛出异常
+template <std::uint32_t P, size_t Size>
+constexpr ModInt<P> Det(const Mat<ModInt<P>, Size, Size> &mat)
+{
+    auto a = mat;
+    ModInt<P> det(1);
+    for (size_t k = 0; k < Size; ++k)
+    {
+        const size_t pivot = Detail::ModPivot(a, k);
+        if (pivot == Size)
+            return ModInt<P>(0);
+        if (pivot != k)
+        {
+            for (size_t j = 0; j < Size; ++j)
+                std::swap(a[k, j], a[pivot, j]);
+            det = -det;
+        }
+        det *= a[k, k];
+        const ModInt<P> inv = a[k, k].Inverse();
+        for (size_t i = k + 1; i < Size; ++i)
+        {
+            const ModInt<P> factor = a[i, k] * inv;
+            for (size_t j = k; j < Size; ++j)
+                a[i, j] -= factor * a[k, j];
+        }
+    }
+    return det;
+}
+
+// 模 P 逆矩阵：Gauss-Jordan 消元，不可逆时抛出异常（P 为合数时同 Det，主元须可逆）
+template <std::uint32_t P, size_t Size>
+constexpr Mat<ModInt<P>, Size, Size> Inverse(const Mat<ModInt<P>, Size, Size> &mat)
+{
+    auto a = mat;
+    auto inv = Mat<ModInt<P>, Size, Size>::MakeIdentity();
+    for (size_t k = 0; k < Size; ++k)
+    {
+        const size_t pivot = Detail::ModPivot(a, k);
+        if (pivot == Size)
+        {
+            throw std::runtime_error("Matrix is singular and cannot be inverted.");
+        }
+        for (size_t j = 0; j < Size; ++j)
+        {
+            std::swap(a[k, j], a[pivot, j]);
+            std::swap(inv[k, j], inv[pivot, j]);
+        }
+        const ModInt<P> scale = a[k, k].Inverse();
+        for (size_t j = 0; j < Size; ++j)
+        {
+            a[k, j] *= scale;
+            inv[k, j] *= scale;
+        }
+        for (size_t i = 0; i < Size; ++i)
+        {
+            if (i == k || a[i, k] == ModInt<P>(0))
+                continue;
+            const ModInt<P> factor = a[i, k];
+            for (size_t j = 0; j < Size; ++j)
+            {
+                a[i, j] -= factor * a[k, j];
+                inv[i, j] -= factor * inv[k, j];
+            }
+        }
+    }
+    return inv;
+}
+
+template <std::uint32_t P, size_t Row, size_t Col>
+using ModMat = Mat<ModInt<P>, Row, Col>;
+
+#endif // MODINT_HPP
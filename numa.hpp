@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "pool.hpp"
+
+// 定义 RMATH_USE_LIBNUMA 并链接 -lnuma 后使用 libnuma；否则退化为页对齐的普通分配，
+// 节点位置由首次触碰决定
+#if defined(RMATH_USE_LIBNUMA) && __has_include(<numa.h>)
+#include <numa.h>
+#define RMATH_HAS_LIBNUMA 1
+#endif
+
+#ifndef NUMA_HPP
+#define NUMA_HPP
+
+// 内存放置策略
+enum class NumaPlacement
+{
+    Default,     // 由首次触碰决定
+    Local,       // 分配线程所在节点
+    Interleaved, // 按页轮流分布在所有节点
+    Node         // 指定节点
+};
+
+namespace Detail
+{
+    inline constexpr std::size_t NumaPageSize = 4096;
+
+    inline bool NumaAvailable()
+    {
+#ifdef RMATH_HAS_LIBNUMA
+        static const bool available = numa_available() >= 0;
+        return available;
+#else
+        return false;
+#endif
+    }
+}
+
+// 节点数（无 libnuma 时视为单节点）
+inline std::size_t NumaNodeCount()
+{
+#ifdef RMATH_HAS_LIBNUMA
+    if (Detail::NumaAvailable())
+        return static_cast<std::size_t>(numa_max_node() + 1);
+#endif
+    return 1;
+}
+
+// CPU 所属节点
+inline int NumaNodeOfCpu(int cpu)
+{
+#ifdef RMATH_HAS_LIBNUMA
+    if (Detail::NumaAvailable())
+        return std::max(0, numa_node_of_cpu(cpu));
+#endif
+    (void)cpu;
+    return 0;
+}
+
+// 按节点分组排列的 CPU 列表，传给 ThreadPool::PinThreads 使相邻工作线程位于同一节点
+inline std::vector<int> NumaCpuOrder()
+{
+    const int cpus = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<int> order(static_cast<std::size_t>(cpus));
+    for (int cpu = 0; cpu < cpus; ++cpu)
+        order[static_cast<std::size_t>(cpu)] = cpu;
+    std::stable_sort(order.begin(), order.end(), [](int a, int b)
+                     { return NumaNodeOfCpu(a) < NumaNodeOfCpu(b); });
+    return order;
+}
+
+// 按放置策略分配的缓冲（不初始化元素，T 须为平凡类型）
+template <typename T>
+struct NumaBuffer final
+{
+    static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+                  "NumaBuffer holds trivial element types only");
+
+private:
+    // 数据
+    T *_data = nullptr;
+    std::size_t _size = 0;
+    bool _numa = false;
+
+    void Release() noexcept
+    {
+        if (!_data)
+            return;
+#ifdef RMATH_HAS_LIBNUMA
+        if (_numa)
+        {
+            numa_free(_data, _size * sizeof(T));
+            _data = nullptr;
+            return;
+        }
+#endif
+        ::operator delete(_data, std::align_val_t{Detail::NumaPageSize});
+        _data = nullptr;
+    }
+
+public:
+    // 构造
+    NumaBuffer() = default;
+
+    explicit NumaBuffer(std::size_t size, NumaPlacement placement = NumaPlacement::Default, int node = 0) : _size(size)
+    {
+        if (size == 0)
+            return;
+        const std::size_t bytes = size * sizeof(T);
+#ifdef RMATH_HAS_LIBNUMA
+        if (placement != NumaPlacement::Default && Detail::NumaAvailable())
+        {
+            void *data = nullptr;
+            switch (placement)
+            {
+            case NumaPlacement::Local:
+                data = numa_alloc_local(bytes);
+                break;
+            case NumaPlacement::Interleaved:
+                data = numa_alloc_interleaved(bytes);
+                break;
+            case NumaPlacement::Node:
+                data = numa_alloc_onnode(bytes, node);
+                break;
+            default:
+                break;
+            }
+            if (!data)
+            {
+                throw std::bad_alloc();
+            }
+            _data = static_cast<T *>(data);
+            _numa = true;
+            return;
+        }
+#endif
+        (void)placement;
+        (void)node;
+        _data = static_cast<T *>(::operator new(bytes, std::align_val_t{Detail::NumaPageSize}));
+    }
+
+    NumaBuffer(const NumaBuffer &) = delete;
+
+    NumaBuffer(NumaBuffer &&other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)), _numa(other._numa)
+    {
+    }
+
+    ~NumaBuffer() { Release(); }
+
+    NumaBuffer &operator=(const NumaBuffer &) = delete;
+
+    NumaBuffer &operator=(NumaBuffer &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Release();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+            _numa = other._numa;
+        }
+        return *this;
+    }
+
+    // 访问
+    T &operator[](std::size_t index) { return _data[index]; }
+
+    const T &operator[](std::size_t index) const { return _data[index]; }
+
+    T *data() noexcept { return _data; }
+
+    const T *data() const noexcept { return _data; }
+
+    std::span<T> span() noexcept { return std::span<T>(_data, _size); }
+
+    std::span<const T> span() const noexcept { return std::span<const T>(_data, _size); }
+
+    // 查询方法
+    std::size_t size() const noexcept { return _size; }
+
+    std::size_t size_in_bytes() const noexcept { return _size * sizeof(T); }
+};
+
+// 首次触碰的对齐粒度（元素个数）：按页对齐划分，使每页只被一个线程触碰
+template <typename T>
+constexpr std::size_t FirstTouchAlign()
+{
+    return std::max<std::size_t>(1, Detail::NumaPageSize / sizeof(T));
+}
+
+// 首次触碰初始化：第 i 个工作线程写入 StaticPartition(size, pool.size(), i, FirstTouchAlign<T>()) 段，
+// 调用线程不触碰任何页。线程已绑定（PinThreads）时，各段数据页落在对应工作线程所在的节点；
+// 后续计算用 StaticParallelFor(pool, 0, size, FirstTouchAlign<T>(), fn) 即可得到相同的划分
+template <typename T>
+void FirstTouch(ThreadPool &pool, std::span<T> data, const T &value = T{})
+{
+    StaticParallelFor(pool, 0, data.size(), FirstTouchAlign<T>(), [&](std::size_t first, std::size_t last)
+                      { std::fill(data.begin() + first, data.begin() + last, value); });
+}
+
+#endif // NUMA_HPP
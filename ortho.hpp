@@ -0,0 +1,123 @@
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include "vec.hpp"
+#include "mat.hpp"
+#include "pool.hpp"
+
+#ifndef ORTHO_HPP
+#define ORTHO_HPP
+
+// 极分解结果：A = rotation * stretch，rotation 正交，stretch 对称半正定
+template <std::floating_point T, size_t Size>
+struct PolarResult final
+{
+    Mat<T, Size, Size> rotation;
+    Mat<T, Size, Size> stretch;
+    size_t iterations = 0;
+};
+
+namespace Detail
+{
+    template <std::floating_point T, size_t Row, size_t Col>
+    T FrobeniusNorm(const Mat<T, Row, Col> &mat)
+    {
+        T sum = 0;
+        for (size_t i = 0; i < Row * Col; ++i)
+            sum += mat[i] * mat[i];
+        return std::sqrt(sum);
+    }
+}
+
+// 修正 Gram–Schmidt：原地正交归一化，线性相关的向量置零，返回独立向量个数
+template <std::floating_point T, size_t N>
+size_t GramSchmidt(std::span<Vec<T, N>> basis, T tolerance = std::numeric_limits<T>::epsilon() * 64)
+{
+    size_t rank = 0;
+    for (size_t i = 0; i < basis.size(); ++i)
+    {
+        auto &v = basis[i];
+        const T original = Length(v);
+        for (size_t j = 0; j < i; ++j)
+        {
+            const T proj = Dot(v, basis[j]);
+            v = MulAdd(-proj, basis[j], v);
+        }
+        const T len = Length(v);
+        if (len <= tolerance * original || len == 0)
+        {
+            v = Vec<T, N>{};
+            continue;
+        }
+        v /= len;
+        ++rank;
+    }
+    return rank;
+}
+
+// 极分解（Higham 缩放牛顿迭代）：X <- (g * X + X^-T / g) / 2
+template <std::floating_point T, size_t Size>
+PolarResult<T, Size> PolarDecompose(const Mat<T, Size, Size> &mat, size_t max_iterations = 32,
+                                    T tolerance = std::numeric_limits<T>::epsilon() * 16)
+{
+    PolarResult<T, Size> result;
+    auto x = mat;
+    for (; result.iterations < max_iterations; ++result.iterations)
+    {
+        const T det = Det(x);
+        if (det == 0)
+        {
+            throw std::runtime_error("Matrix is singular and has no unique polar decomposition.");
+        }
+        const auto inv_t = Transpose(Adjoint(x)) * (static_cast<T>(1) / det);
+        const T gamma = std::sqrt(Detail::FrobeniusNorm(inv_t) / Detail::FrobeniusNorm(x));
+        const auto next = (x * gamma + inv_t * (static_cast<T>(1) / gamma)) * static_cast<T>(0.5);
+        const T change = Detail::FrobeniusNorm(next - x);
+        x = next;
+        if (change <= tolerance * Detail::FrobeniusNorm(x))
+        {
+            ++result.iterations;
+            break;
+        }
+    }
+    result.rotation = x;
+    const auto h = Transpose(x) * mat;
+    result.stretch = (h + Transpose(h)) * static_cast<T>(0.5);
+    return result;
+}
+
+// 重新正交化：返回距离 mat 最近（Frobenius 范数意义下）的正交矩阵
+template <std::floating_point T, size_t Size>
+Mat<T, Size, Size> Orthonormalize(const Mat<T, Size, Size> &mat)
+{
+    return PolarDecompose(mat).rotation;
+}
+
+// 批量重新正交化（原地）
+template <std::floating_point T, size_t Size>
+void OrthonormalizeBatch(std::span<Mat<T, Size, Size>> mats)
+{
+    for (auto &m : mats)
+        m = Orthonormalize(m);
+}
+
+template <std::floating_point T, size_t Size>
+void OrthonormalizeBatch(std::span<Mat<T, Size, Size>> mats, ThreadPool &pool)
+{
+    ParallelFor(pool, 0, mats.size(), 256, [&](size_t i)
+                { mats[i] = Orthonormalize(mats[i]); });
+}
+
+// 批量 Gram–Schmidt：sets 中每个元素为一组 K 个向量的基
+template <std::floating_point T, size_t N, size_t K>
+void GramSchmidtBatch(std::span<std::array<Vec<T, N>, K>> sets, ThreadPool &pool)
+{
+    ParallelFor(pool, 0, sets.size(), 256, [&](size_t i)
+                { GramSchmidt(std::span<Vec<T, N>>(sets[i])); });
+}
+
+#endif // ORTHO_HPP
@@ -0,0 +1,378 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "gemm.hpp"
+#include "pool.hpp"
+#include "async.hpp"
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define RMATH_HAS_MMAP 1
+#endif
+
+#ifndef OUTOFCORE_HPP
+#define OUTOFCORE_HPP
+
+// 内存映射文件（POSIX mmap）：只读打开已有文件，或创建指定大小的可写文件
+struct MappedFile final
+{
+private:
+    // 数据
+    void *_data = nullptr;
+    std::size_t _bytes = 0;
+    int _fd = -1;
+    bool _writable = false;
+
+    void Release() noexcept
+    {
+#ifdef RMATH_HAS_MMAP
+        if (_data && _bytes)
+            munmap(_data, _bytes);
+        if (_fd >= 0)
+            close(_fd);
+#endif
+        _data = nullptr;
+        _bytes = 0;
+        _fd = -1;
+    }
+
+public:
+    // 构造
+    MappedFile() = default;
+
+    MappedFile(const std::string &path, std::size_t bytes, bool writable) : _bytes(bytes), _writable(writable)
+    {
+#ifdef RMATH_HAS_MMAP
+        _fd = writable ? open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644) : open(path.c_str(), O_RDONLY);
+        if (_fd < 0)
+        {
+            throw std::runtime_error("Cannot open mapped file: " + path);
+        }
+        if (writable)
+        {
+            if (ftruncate(_fd, static_cast<off_t>(bytes)) != 0)
+            {
+                Release();
+                throw std::runtime_error("Cannot resize mapped file: " + path);
+            }
+        }
+        else
+        {
+            struct stat info;
+            if (fstat(_fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < bytes)
+            {
+                Release();
+                throw std::runtime_error("Mapped file is smaller than the matrix: " + path);
+            }
+        }
+        if (bytes == 0)
+            return;
+        void *data = mmap(nullptr, bytes, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, _fd, 0);
+        if (data == MAP_FAILED)
+        {
+            Release();
+            throw std::runtime_error("mmap failed: " + path);
+        }
+        _data = data;
+#else
+        (void)path;
+        throw std::runtime_error("Memory-mapped files are not supported on this platform");
+#endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _bytes(std::exchange(other._bytes, 0)),
+          _fd(std::exchange(other._fd, -1)), _writable(other._writable)
+    {
+    }
+
+    ~MappedFile() { Release(); }
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile &operator=(MappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Release();
+            _data = std::exchange(other._data, nullptr);
+            _bytes = std::exchange(other._bytes, 0);
+            _fd = std::exchange(other._fd, -1);
+            _writable = other._writable;
+        }
+        return *this;
+    }
+
+    // 提示内核预读 [offset, offset + bytes)
+    void WillNeed(std::size_t offset, std::size_t bytes) const noexcept
+    {
+#ifdef RMATH_HAS_MMAP
+        if (!_data || bytes == 0)
+            return;
+        const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        const std::size_t first = offset / page * page;
+        madvise(static_cast<char *>(_data) + first, std::min(_bytes, offset + bytes) - first, MADV_WILLNEED);
+#else
+        (void)offset;
+        (void)bytes;
+#endif
+    }
+
+    // 把修改写回文件
+    void Flush() const
+    {
+#ifdef RMATH_HAS_MMAP
+        if (_data && _writable && msync(_data, _bytes, MS_SYNC) != 0)
+        {
+            throw std::runtime_error("msync failed");
+        }
+#endif
+    }
+
+    // 访问
+    void *data() const noexcept { return _data; }
+
+    // 查询方法
+    std::size_t size() const noexcept { return _bytes; }
+
+    bool writable() const noexcept { return _writable; }
+};
+
+// 文件中的行主序矩阵（无文件头，rows * cols 个 T 连续存放）
+template <typename T>
+struct MappedMatrix final
+{
+private:
+    // 数据
+    MappedFile _file;
+    std::size_t _rows = 0, _cols = 0;
+
+    MappedMatrix(MappedFile file, std::size_t rows, std::size_t cols) : _file(std::move(file)), _rows(rows), _cols(cols) {}
+
+public:
+    // 打开已有矩阵文件（只读）
+    static MappedMatrix Open(const std::string &path, std::size_t rows, std::size_t cols)
+    {
+        return MappedMatrix(MappedFile(path, rows * cols * sizeof(T), false), rows, cols);
+    }
+
+    // 创建矩阵文件（可写，初始内容为 0）
+    static MappedMatrix Create(const std::string &path, std::size_t rows, std::size_t cols)
+    {
+        return MappedMatrix(MappedFile(path, rows * cols * sizeof(T), true), rows, cols);
+    }
+
+    // 访问
+    MatrixView<const T> View() const { return MatrixView<const T>(static_cast<const T *>(_file.data()), _rows, _cols); }
+
+    MatrixView<T> MutableView()
+    {
+        if (!_file.writable())
+        {
+            throw std::runtime_error("MappedMatrix was opened read-only");
+        }
+        return MatrixView<T>(static_cast<T *>(_file.data()), _rows, _cols);
+    }
+
+    // 预读第 [row, row + rows) 行
+    void WillNeed(std::size_t row, std::size_t rows) const { _file.WillNeed(row * _cols * sizeof(T), rows * _cols * sizeof(T)); }
+
+    void Flush() const { _file.Flush(); }
+
+    // 查询方法
+    std::size_t rows() const noexcept { return _rows; }
+
+    std::size_t cols() const noexcept { return _cols; }
+};
+
+// 外存乘法的分块参数：内存中同时驻留两组 (A 块, B 块) 与一个 C 块
+struct OutOfCoreOptions final
+{
+    std::size_t tile_rows = 2048;
+    std::size_t tile_cols = 2048;
+    std::size_t tile_depth = 2048;
+    GemmConfig gemm{};
+};
+
+// 进度与吞吐计数：计算过程中可在其他线程读取
+struct OutOfCoreProgress final
+{
+    std::atomic<std::uint64_t> tiles_total = 0;
+    std::atomic<std::uint64_t> tiles_done = 0;
+    std::atomic<std::uint64_t> bytes_read = 0;
+    std::atomic<std::uint64_t> bytes_written = 0;
+    std::atomic<std::uint64_t> flops = 0;
+    std::atomic<std::int64_t> start_ns = 0;
+
+    // 查询方法
+    double seconds() const
+    {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count() - start_ns.load()) * 1e-9;
+    }
+
+    double fraction() const
+    {
+        const auto total = tiles_total.load();
+        return total ? static_cast<double>(tiles_done.load()) / static_cast<double>(total) : 1.0;
+    }
+
+    double gflops_per_second() const { return static_cast<double>(flops.load()) * 1e-9 / std::max(seconds(), 1e-9); }
+
+    double read_bytes_per_second() const { return static_cast<double>(bytes_read.load()) / std::max(seconds(), 1e-9); }
+};
+
+namespace Detail
+{
+    // 一组输入块的打包缓冲
+    template <typename T>
+    struct OutOfCoreBuffer
+    {
+        std::vector<T> a, b;
+        std::size_t rows = 0, cols = 0, depth = 0;
+    };
+
+    // 把映射文件中的 A(i, k)、B(k, j) 块拷贝到连续缓冲；缺页 I/O 发生在这里
+    template <typename T>
+    std::size_t LoadTiles(const MappedMatrix<T> &a, const MappedMatrix<T> &b, OutOfCoreBuffer<T> &buffer,
+                          std::size_t row, std::size_t col, std::size_t depth, const OutOfCoreOptions &options)
+    {
+        buffer.rows = std::min(options.tile_rows, a.rows() - row);
+        buffer.cols = std::min(options.tile_cols, b.cols() - col);
+        buffer.depth = std::min(options.tile_depth, a.cols() - depth);
+        buffer.a.resize(buffer.rows * buffer.depth);
+        buffer.b.resize(buffer.depth * buffer.cols);
+
+        const auto av = a.View(), bv = b.View();
+        a.WillNeed(row, buffer.rows);
+        b.WillNeed(depth, buffer.depth);
+        for (std::size_t r = 0; r < buffer.rows; ++r)
+            std::memcpy(buffer.a.data() + r * buffer.depth, &av[row + r, depth], buffer.depth * sizeof(T));
+        for (std::size_t r = 0; r < buffer.depth; ++r)
+            std::memcpy(buffer.b.data() + r * buffer.cols, &bv[depth + r, col], buffer.cols * sizeof(T));
+        return (buffer.a.size() + buffer.b.size()) * sizeof(T);
+    }
+}
+
+// 外存矩阵乘法：C = A * B，三者均为映射文件。按 (C 行块, C 列块, k 块) 顺序流水处理，
+// 计算当前块的同时在线程池上预取下一组输入块（双缓冲），C 块累加完成后逐块写回
+template <Detail::FloatPolicy P, typename T>
+void OutOfCoreMultiply(P, const MappedMatrix<T> &a, const MappedMatrix<T> &b, MappedMatrix<T> &c, ThreadPool &pool,
+                       const OutOfCoreOptions &options = {}, OutOfCoreProgress *progress = nullptr)
+{
+    Detail::CheckGemmShape(a.rows(), a.cols(), b.rows(), b.cols(), c.rows(), c.cols());
+    if (options.tile_rows == 0 || options.tile_cols == 0 || options.tile_depth == 0)
+    {
+        throw std::runtime_error("OutOfCoreMultiply tile sizes must be positive");
+    }
+
+    const std::size_t row_tiles = (a.rows() + options.tile_rows - 1) / options.tile_rows;
+    const std::size_t col_tiles = (b.cols() + options.tile_cols - 1) / options.tile_cols;
+    const std::size_t depth_tiles = std::max<std::size_t>(1, (a.cols() + options.tile_depth - 1) / options.tile_depth);
+    const std::size_t steps = row_tiles * col_tiles * depth_tiles;
+
+    OutOfCoreProgress local;
+    OutOfCoreProgress &stats = progress ? *progress : local;
+    stats.tiles_total = row_tiles * col_tiles;
+    stats.tiles_done = 0;
+    stats.bytes_read = 0;
+    stats.bytes_written = 0;
+    stats.flops = 0;
+    stats.start_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    if (steps == 0 || a.cols() == 0)
+    {
+        // k 为 0 时结果为零矩阵，Create 已保证初始内容为 0
+        stats.tiles_done = stats.tiles_total.load();
+        return;
+    }
+
+    // 第 s 步对应的块坐标
+    auto origin = [&](std::size_t s)
+    {
+        const std::size_t k = s % depth_tiles;
+        const std::size_t j = (s / depth_tiles) % col_tiles;
+        const std::size_t i = s / (depth_tiles * col_tiles);
+        return std::array<std::size_t, 3>{i * options.tile_rows, j * options.tile_cols, k * options.tile_depth};
+    };
+    auto load = [&](std::size_t s, Detail::OutOfCoreBuffer<T> &buffer)
+    {
+        const auto [row, col, depth] = origin(s);
+        return Detail::LoadTiles(a, b, buffer, row, col, depth, options);
+    };
+
+    // 在单线程池唯一的工作线程上调用时，预取任务要等本函数返回才会执行，get() 将永远等待；
+    // 此时退化为同步读取
+    const bool async_prefetch = !(pool.size() == 1 && pool.in_worker());
+
+    Detail::OutOfCoreBuffer<T> buffers[2];
+    std::vector<T> c_tile;
+    auto cv = c.MutableView();
+    stats.bytes_read += load(0, buffers[0]);
+
+    for (std::size_t s = 0; s < steps; ++s)
+    {
+        auto &current = buffers[s % 2];
+        auto &next = buffers[(s + 1) % 2];
+
+        std::optional<AsyncResult<std::size_t>> prefetch;
+        if (s + 1 < steps && async_prefetch)
+            prefetch.emplace(RunAsync(pool, [&, s]
+                                      { return load(s + 1, next); }));
+
+        const auto [row, col, depth] = origin(s);
+        if (depth == 0)
+            c_tile.assign(current.rows * current.cols, T(0));
+        MatrixView<const T> av(current.a.data(), current.rows, current.depth);
+        MatrixView<const T> bv(current.b.data(), current.depth, current.cols);
+        try
+        {
+            Gemm(P{}, av, bv, MatrixView<T>(c_tile.data(), current.rows, current.cols), pool, options.gemm);
+        }
+        catch (...)
+        {
+            // 预取任务仍在写 next，须等它结束后才能释放缓冲
+            if (prefetch)
+                prefetch->wait();
+            throw;
+        }
+        stats.flops += 2ull * current.rows * current.cols * current.depth;
+
+        // 最后一个 k 块完成后写回 C
+        if (depth + current.depth == a.cols())
+        {
+            for (std::size_t r = 0; r < current.rows; ++r)
+                std::memcpy(&cv[row + r, col], c_tile.data() + r * current.cols, current.cols * sizeof(T));
+            stats.bytes_written += c_tile.size() * sizeof(T);
+            ++stats.tiles_done;
+        }
+
+        if (prefetch)
+            stats.bytes_read += prefetch->get();
+        else if (s + 1 < steps)
+            stats.bytes_read += load(s + 1, next);
+    }
+    c.Flush();
+}
+
+template <typename T>
+void OutOfCoreMultiply(const MappedMatrix<T> &a, const MappedMatrix<T> &b, MappedMatrix<T> &c, ThreadPool &pool,
+                       const OutOfCoreOptions &options = {}, OutOfCoreProgress *progress = nullptr)
+{
+    OutOfCoreMultiply(DefaultPolicy{}, a, b, c, pool, options, progress);
+}
+
+#endif // OUTOFCORE_HPP
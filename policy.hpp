@@ -0,0 +1,161 @@
+#include <cmath>
+#include <cfloat>
+#include <cstddef>
+#include <concepts>
+#include <type_traits>
+
+#ifndef POLICY_HPP
+#define POLICY_HPP
+
+// 浮点策略：快速（允许编译器自由收缩乘加）
+struct FastPolicy final
+{
+};
+
+// 浮点策略：确定性（固定归约树，显式控制是否使用 FMA）
+template <bool UseFma = false>
+struct DeterministicPolicy final
+{
+    static constexpr bool fma = UseFma;
+};
+
+using Deterministic = DeterministicPolicy<false>;
+using DeterministicFma = DeterministicPolicy<true>;
+
+// 默认策略：定义 RMATH_DETERMINISTIC 后所有运算符均走确定性路径
+#ifdef RMATH_DETERMINISTIC
+using DefaultPolicy = Deterministic;
+#else
+using DefaultPolicy = FastPolicy;
+#endif
+
+#if defined(RMATH_DETERMINISTIC) && defined(__FAST_MATH__)
+#error "RMATH_DETERMINISTIC cannot be combined with -ffast-math."
+#endif
+
+namespace Detail
+{
+    template <typename P>
+    struct IsDeterministicPolicy : std::false_type
+    {
+    };
+
+    template <bool UseFma>
+    struct IsDeterministicPolicy<DeterministicPolicy<UseFma>> : std::true_type
+    {
+    };
+
+    // 概念：FloatPolicy 表示浮点策略标签
+    template <typename P>
+    concept FloatPolicy = std::same_as<P, FastPolicy> || IsDeterministicPolicy<P>::value;
+
+    // 确定性归约的固定通道数，标量与向量化路径使用同一棵归约树
+    inline constexpr std::size_t ReduceLanes = 4;
+
+    template <typename P>
+    consteval void CheckPolicy()
+    {
+        if constexpr (IsDeterministicPolicy<P>::value)
+        {
+#ifdef __FAST_MATH__
+            static_assert(sizeof(P) == 0, "Deterministic policy cannot be used with -ffast-math.");
+#endif
+            static_assert(FLT_EVAL_METHOD == 0, "Deterministic policy requires FLT_EVAL_METHOD == 0 (no x87 excess precision).");
+        }
+    }
+
+    // 目标平台是否有硬件 FMA（软件模拟的 std::fma 远慢于分开的乘加）
+#if defined(FP_FAST_FMAF) || defined(__FP_FAST_FMAF)
+    inline constexpr bool FastFmaFloat = true;
+#else
+    inline constexpr bool FastFmaFloat = false;
+#endif
+#if defined(FP_FAST_FMA) || defined(__FP_FAST_FMA)
+    inline constexpr bool FastFmaDouble = true;
+#else
+    inline constexpr bool FastFmaDouble = false;
+#endif
+
+    template <typename T>
+    inline constexpr bool HasFastFma = (std::same_as<T, float> && FastFmaFloat) ||
+                                       (std::same_as<T, double> && FastFmaDouble);
+
+    // 阻止编译器把乘法与后续加法收缩为 FMA
+    template <typename T>
+    constexpr T NoContract(T value)
+    {
+        if consteval
+        {
+            return value;
+        }
+        else
+        {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__SSE2__))
+            if constexpr (std::same_as<T, float> || std::same_as<T, double>)
+                __asm__("" : "+x"(value));
+#elif defined(__GNUC__) && defined(__aarch64__)
+            if constexpr (std::same_as<T, float> || std::same_as<T, double>)
+                __asm__("" : "+w"(value));
+#else
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                volatile T barrier = value;
+                value = barrier;
+            }
+#endif
+            return value;
+        }
+    }
+
+    // 按策略计算 a * b + c
+    template <typename P, typename T>
+    constexpr T MulAdd(const T &a, const T &b, const T &c)
+    {
+        if constexpr (!std::is_floating_point_v<T>)
+        {
+            return a * b + c;
+        }
+        else if constexpr (std::same_as<P, FastPolicy>)
+        {
+            if constexpr (HasFastFma<T>)
+                return std::fma(a, b, c);
+            else
+                return a * b + c;
+        }
+        else if constexpr (P::fma)
+        {
+            return std::fma(a, b, c);
+        }
+        else
+        {
+            return NoContract(a * b) + c;
+        }
+    }
+
+    // 按策略计算 sum(a(i) * b(i))，确定性策略使用固定的 4 通道归约树
+    template <typename P, typename R, typename Fa, typename Fb>
+    constexpr R Reduce(std::size_t n, Fa &&a, Fb &&b)
+    {
+        CheckPolicy<P>();
+        if constexpr (IsDeterministicPolicy<P>::value && std::is_floating_point_v<R>)
+        {
+            R lanes[ReduceLanes] = {};
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                lanes[i % ReduceLanes] = MulAdd<P, R>(a(i), b(i), lanes[i % ReduceLanes]);
+            }
+            return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+        }
+        else
+        {
+            R sum = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                sum = MulAdd<P, R>(a(i), b(i), sum);
+            }
+            return sum;
+        }
+    }
+}
+
+#endif // POLICY_HPP
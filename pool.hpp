@@ -0,0 +1,302 @@
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+#include <vector>
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <exception>
+#include <algorithm>
+#include <utility>
+#include "trace.hpp"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#ifndef POOL_HPP
+#define POOL_HPP
+
+struct ThreadPool;
+
+namespace Detail
+{
+    // 当前线程所属的线程池（不是池线程时为 nullptr）
+    inline thread_local const ThreadPool *CurrentThreadPool = nullptr;
+}
+
+// 线程池
+struct ThreadPool final
+{
+private:
+    // 数据
+    std::vector<std::thread> _workers;
+    std::deque<std::function<void()>> _jobs;
+    // 指定由某个工作线程执行的任务，下标为工作线程编号
+    std::vector<std::deque<std::function<void()>>> _own_jobs;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::size_t _batch;
+    std::size_t _threads;
+    bool _stop = false;
+
+    // 工作线程：每次加锁取出至多 _batch 个任务连续执行，摊薄同步开销；
+    // 每次最多取队列长度 / 线程数 个，避免短时突发的任务被一个线程囤积而其他线程空闲
+    void WorkerLoop(std::size_t worker)
+    {
+        Detail::CurrentThreadPool = this;
+        std::vector<std::function<void()>> local;
+        local.reserve(_batch);
+        for (;;)
+        {
+            {
+                std::unique_lock lock(_mutex);
+                auto &own = _own_jobs[worker];
+                _cv.wait(lock, [&]
+                         { return _stop || !_jobs.empty() || !own.empty(); });
+                if (!own.empty())
+                {
+                    // 本线程专属任务优先
+                    local.push_back(std::move(own.front()));
+                    own.pop_front();
+                }
+                else
+                {
+                    if (_jobs.empty())
+                        return;
+                    const std::size_t take = std::clamp<std::size_t>(_jobs.size() / _threads, 1, _batch);
+                    while (!_jobs.empty() && local.size() < take)
+                    {
+                        local.push_back(std::move(_jobs.front()));
+                        _jobs.pop_front();
+                    }
+                }
+            }
+            for (auto &job : local)
+                job();
+            local.clear();
+        }
+    }
+
+public:
+    // 构造
+    explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency(), std::size_t batch = 8)
+        : _batch(batch == 0 ? 1 : batch)
+    {
+        if (threads == 0)
+            threads = 1;
+        _threads = threads;
+        _own_jobs.resize(threads);
+        _workers.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i)
+            _workers.emplace_back([this, i]
+                                  { WorkerLoop(i); });
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // 析构：执行完队列中剩余任务后退出
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+        for (auto &worker : _workers)
+            worker.join();
+    }
+
+    // 提交任务
+    void Submit(std::function<void()> job)
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _jobs.push_back(std::move(job));
+        }
+        _cv.notify_one();
+    }
+
+    // 每个工作线程恰好执行一次 fn(worker)，调用线程不参与计算，等待全部完成后返回（重新抛出第一个异常）。
+    // 工作线程与编号的对应固定不变，配合 PinThreads 可让第 i 段数据始终由同一 CPU 处理。
+    // 不能在池线程内调用
+    template <typename Fn>
+    void RunOnEachWorker(Fn &&fn)
+    {
+        std::mutex done_mutex;
+        std::condition_variable done_cv;
+        std::size_t remaining = _threads;
+        std::exception_ptr error;
+        {
+            std::lock_guard lock(_mutex);
+            for (std::size_t i = 0; i < _threads; ++i)
+            {
+                _own_jobs[i].push_back([&, i]
+                                       {
+                                           std::exception_ptr err;
+                                           try
+                                           {
+                                               fn(i);
+                                           }
+                                           catch (...)
+                                           {
+                                               err = std::current_exception();
+                                           }
+                                           std::lock_guard done_lock(done_mutex);
+                                           if (err && !error)
+                                               error = err;
+                                           if (--remaining == 0)
+                                               done_cv.notify_one(); });
+            }
+        }
+        _cv.notify_all();
+        std::unique_lock lock(done_mutex);
+        done_cv.wait(lock, [&]
+                     { return remaining == 0; });
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    // 绑定线程：第 i 个工作线程固定到 cpus[i % cpus.size()]，cpus 为空时依次使用 0..hardware_concurrency-1；
+    // 平台不支持或绑定失败时返回 false。配合首次触碰初始化可让数据页留在访问它的 NUMA 节点上
+    bool PinThreads(const std::vector<int> &cpus = {})
+    {
+#if defined(__linux__)
+        const std::size_t hw = std::max(1u, std::thread::hardware_concurrency());
+        bool ok = true;
+        for (std::size_t i = 0; i < _workers.size(); ++i)
+        {
+            const int cpu = cpus.empty() ? static_cast<int>(i % hw) : cpus[i % cpus.size()];
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            ok = pthread_setaffinity_np(_workers[i].native_handle(), sizeof(set), &set) == 0 && ok;
+        }
+        return ok;
+#else
+        (void)cpus;
+        return false;
+#endif
+    }
+
+    // 查询方法
+    std::size_t size() const noexcept { return _workers.size(); }
+
+    // 当前线程是否为本池的工作线程
+    bool in_worker() const noexcept { return Detail::CurrentThreadPool == this; }
+
+    // 全局默认线程池
+    static ThreadPool &Default()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+};
+
+namespace Detail
+{
+    // 并行 for 的共享状态：调用线程与池线程从同一个计数器领取块
+    struct ParallelForState
+    {
+        std::atomic<std::size_t> next = 0;
+        std::atomic<std::size_t> finished = 0;
+        std::size_t chunks = 0;
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::exception_ptr error;
+
+        template <typename Fn>
+        void Drain(Fn &run)
+        {
+            for (;;)
+            {
+                const std::size_t chunk = next.fetch_add(1, std::memory_order_relaxed);
+                if (chunk >= chunks)
+                    return;
+                try
+                {
+                    run(chunk);
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(mutex);
+                    if (!error)
+                        error = std::current_exception();
+                }
+                if (finished.fetch_add(1, std::memory_order_acq_rel) + 1 == chunks)
+                {
+                    std::lock_guard lock(mutex);
+                    cv.notify_all();
+                }
+            }
+        }
+    };
+}
+
+// 并行 for：[begin, end) 按 grain 切块，fn(i) 对每个下标调用一次；调用线程也参与计算，可在池线程内嵌套使用
+template <typename Fn>
+void ParallelFor(ThreadPool &pool, std::size_t begin, std::size_t end, std::size_t grain, Fn &&fn)
+{
+    if (end <= begin)
+        return;
+    if (grain == 0)
+        grain = 1;
+
+    auto state = std::make_shared<Detail::ParallelForState>();
+    state->chunks = (end - begin + grain - 1) / grain;
+    auto run = [&](std::size_t chunk)
+    {
+        RMATH_TRACE_SCOPE("ParallelFor chunk");
+        const std::size_t first = begin + chunk * grain;
+        const std::size_t last = std::min(end, first + grain);
+        for (std::size_t i = first; i < last; ++i)
+            fn(i);
+    };
+
+    // 晚启动的辅助任务领不到块时直接返回，不会触碰已失效的 run
+    const std::size_t helpers = std::min(pool.size(), state->chunks - 1);
+    for (std::size_t h = 0; h < helpers; ++h)
+        pool.Submit([state, runner = &run]
+                    { state->Drain(*runner); });
+
+    state->Drain(run);
+    {
+        std::unique_lock lock(state->mutex);
+        state->cv.wait(lock, [&]
+                       { return state->finished.load(std::memory_order_acquire) == state->chunks; });
+    }
+    if (state->error)
+        std::rethrow_exception(state->error);
+}
+
+// 静态划分：把 [0, count) 按 align 个元素对齐切成 parts 段，返回第 part 段 [first, last)
+inline std::pair<std::size_t, std::size_t> StaticPartition(std::size_t count, std::size_t parts, std::size_t part,
+                                                           std::size_t align = 1)
+{
+    align = std::max<std::size_t>(align, 1);
+    const std::size_t blocks = (count + align - 1) / align;
+    const std::size_t base = blocks / parts, extra = blocks % parts;
+    const std::size_t first_block = part * base + std::min(part, extra);
+    const std::size_t last_block = first_block + base + (part < extra ? 1 : 0);
+    return {std::min(count, first_block * align), std::min(count, last_block * align)};
+}
+
+// 静态并行 for：第 i 个工作线程处理 StaticPartition(end - begin, pool.size(), i, align) 段，调用 fn(first, last)。
+// 相同的 count 与 align 总得到相同的划分，首次触碰与后续计算用它即可让每段数据留在处理它的线程所在节点
+template <typename Fn>
+void StaticParallelFor(ThreadPool &pool, std::size_t begin, std::size_t end, std::size_t align, Fn &&fn)
+{
+    if (end <= begin)
+        return;
+    pool.RunOnEachWorker([&](std::size_t worker)
+                         {
+                             const auto [first, last] = StaticPartition(end - begin, pool.size(), worker, align);
+                             if (first < last)
+                                 fn(begin + first, begin + last); });
+}
+
+#endif // POOL_HPP
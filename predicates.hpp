@@ -0,0 +1,294 @@
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include "vec.hpp"
+#include "policy.hpp"
+
+#ifndef PREDICATES_HPP
+#define PREDICATES_HPP
+
+// 自适应精确几何判定（Shewchuk）：先用浮点误差界过滤，只有结果不可信时才走扩展精度的精确计算
+// 精确路径仅依赖 round-to-nearest 与正确舍入的 std::fma，不可与 -ffast-math 同用
+
+namespace Detail
+{
+    // 浮点展开：若干互不重叠的 double 分量之和，按量级从小到大存放
+    template <std::size_t Cap>
+    struct Expansion
+    {
+        std::array<double, Cap> c;
+        std::size_t n = 0;
+
+        constexpr double Sign() const { return n == 0 ? 0.0 : c[n - 1]; }
+    };
+
+    inline void FastTwoSum(double a, double b, double &x, double &y)
+    {
+        x = a + b;
+        double bvirt = x - a;
+        y = b - bvirt;
+    }
+
+    inline void TwoSum(double a, double b, double &x, double &y)
+    {
+        x = a + b;
+        double bvirt = x - a;
+        double avirt = x - bvirt;
+        double bround = b - bvirt;
+        double around = a - avirt;
+        y = around + bround;
+    }
+
+    inline void TwoProduct(double a, double b, double &x, double &y)
+    {
+        x = NoContract(a * b);
+        y = std::fma(a, b, -x);
+    }
+
+    // 两个展开相加并消去零分量
+    template <std::size_t A, std::size_t B>
+    Expansion<A + B> ExpansionSum(const Expansion<A> &e, const Expansion<B> &f)
+    {
+        Expansion<A + B> h;
+        std::size_t ei = 0, fi = 0;
+        double q, qnew, hh;
+        auto take = [&]()
+        {
+            if (fi >= f.n || (ei < e.n && ((f.c[fi] > e.c[ei]) == (f.c[fi] > -e.c[ei]))))
+                return e.c[ei++];
+            return f.c[fi++];
+        };
+
+        q = take();
+        if (ei < e.n && fi < f.n)
+        {
+            FastTwoSum(take(), q, qnew, hh);
+            q = qnew;
+            if (hh != 0.0)
+                h.c[h.n++] = hh;
+        }
+        while (ei < e.n || fi < f.n)
+        {
+            TwoSum(q, take(), qnew, hh);
+            q = qnew;
+            if (hh != 0.0)
+                h.c[h.n++] = hh;
+        }
+        if (q != 0.0 || h.n == 0)
+            h.c[h.n++] = q;
+        return h;
+    }
+
+    // 展开乘以标量并消去零分量
+    template <std::size_t A>
+    Expansion<2 * A> ExpansionScale(const Expansion<A> &e, double b)
+    {
+        Expansion<2 * A> h;
+        double q, hh, p1, p0, sum;
+        TwoProduct(e.c[0], b, q, hh);
+        if (hh != 0.0)
+            h.c[h.n++] = hh;
+        for (std::size_t i = 1; i < e.n; ++i)
+        {
+            TwoProduct(e.c[i], b, p1, p0);
+            TwoSum(q, p0, sum, hh);
+            if (hh != 0.0)
+                h.c[h.n++] = hh;
+            FastTwoSum(p1, sum, q, hh);
+            if (hh != 0.0)
+                h.c[h.n++] = hh;
+        }
+        if (q != 0.0 || h.n == 0)
+            h.c[h.n++] = q;
+        return h;
+    }
+
+    template <std::size_t A>
+    Expansion<A> ExpansionNegate(Expansion<A> e)
+    {
+        for (std::size_t i = 0; i < e.n; ++i)
+            e.c[i] = -e.c[i];
+        return e;
+    }
+
+    // 精确的 px * qy - qx * py
+    inline Expansion<4> ExactDet2(double px, double py, double qx, double qy)
+    {
+        Expansion<2> l, r;
+        TwoProduct(px, qy, l.c[1], l.c[0]);
+        TwoProduct(qx, py, r.c[1], r.c[0]);
+        l.n = r.n = 2;
+        r.c[0] = -r.c[0];
+        r.c[1] = -r.c[1];
+        return ExpansionSum(l, r);
+    }
+
+    // 精确的 3x3 行列式 |p; q; r|，沿 z 列展开
+    inline Expansion<24> ExactDet3(const double *p, const double *q, const double *r)
+    {
+        auto a = ExpansionScale(ExactDet2(q[0], q[1], r[0], r[1]), p[2]);
+        auto b = ExpansionScale(ExactDet2(p[0], p[1], r[0], r[1]), -q[2]);
+        auto c = ExpansionScale(ExactDet2(p[0], p[1], q[0], q[1]), r[2]);
+        return ExpansionSum(ExpansionSum(a, b), c);
+    }
+
+    // 精确的 4x4 行列式 |p 1; q 1; r 1; s 1|，等于 |p-s; q-s; r-s|
+    inline Expansion<96> ExactOrient3D(const double *p, const double *q, const double *r, const double *s)
+    {
+        auto a = ExpansionNegate(ExactDet3(q, r, s));
+        auto b = ExactDet3(p, r, s);
+        auto c = ExpansionNegate(ExactDet3(p, q, s));
+        auto d = ExactDet3(p, q, r);
+        return ExpansionSum(ExpansionSum(a, b), ExpansionSum(c, d));
+    }
+
+    // 精确的 |p|^2 * det
+    template <std::size_t A>
+    Expansion<12 * A> ExactLiftScale(const Expansion<A> &det, const double *p)
+    {
+        auto x = ExpansionScale(ExpansionScale(det, p[0]), p[0]);
+        auto y = ExpansionScale(ExpansionScale(det, p[1]), p[1]);
+        auto z = ExpansionScale(ExpansionScale(det, p[2]), p[2]);
+        return ExpansionSum(ExpansionSum(x, y), z);
+    }
+
+    inline constexpr double PredicateEpsilon = std::numeric_limits<double>::epsilon() / 2;
+    inline constexpr double CcwErrBound = (3.0 + 16.0 * PredicateEpsilon) * PredicateEpsilon;
+    inline constexpr double O3dErrBound = (7.0 + 56.0 * PredicateEpsilon) * PredicateEpsilon;
+    inline constexpr double IspErrBound = (16.0 + 224.0 * PredicateEpsilon) * PredicateEpsilon;
+
+    template <typename T>
+    concept PredicateScalar = std::same_as<T, float> || std::same_as<T, double>;
+}
+
+// 二维方向：a, b, c 逆时针为正，顺时针为负，共线为零（符号精确）
+template <Detail::PredicateScalar T>
+double Orient2D(const Vec<T, 2> &a, const Vec<T, 2> &b, const Vec<T, 2> &c)
+{
+    const double ax = a[0], ay = a[1], bx = b[0], by = b[1], cx = c[0], cy = c[1];
+
+    const double detleft = Detail::NoContract((ax - cx) * (by - cy));
+    const double detright = Detail::NoContract((ay - cy) * (bx - cx));
+    const double det = detleft - detright;
+
+    double detsum;
+    if (detleft > 0)
+    {
+        if (detright <= 0)
+            return det;
+        detsum = detleft + detright;
+    }
+    else if (detleft < 0)
+    {
+        if (detright >= 0)
+            return det;
+        detsum = -detleft - detright;
+    }
+    else
+    {
+        return det;
+    }
+
+    const double errbound = Detail::CcwErrBound * detsum;
+    if (det >= errbound || -det >= errbound)
+        return det;
+
+    // 精确路径：|a 1; b 1; c 1| 沿常数列展开
+    auto bc = Detail::ExactDet2(bx, by, cx, cy);
+    auto ac = Detail::ExactDet2(ax, ay, cx, cy);
+    auto ab = Detail::ExactDet2(ax, ay, bx, by);
+    return Detail::ExpansionSum(Detail::ExpansionSum(bc, Detail::ExpansionNegate(ac)), ab).Sign();
+}
+
+// 三维方向：从 a, b, c 逆时针的一侧看 d 在平面下方为正，共面为零（符号精确）
+template <Detail::PredicateScalar T>
+double Orient3D(const Vec<T, 3> &a, const Vec<T, 3> &b, const Vec<T, 3> &c, const Vec<T, 3> &d)
+{
+    const double adx = double(a[0]) - d[0], ady = double(a[1]) - d[1], adz = double(a[2]) - d[2];
+    const double bdx = double(b[0]) - d[0], bdy = double(b[1]) - d[1], bdz = double(b[2]) - d[2];
+    const double cdx = double(c[0]) - d[0], cdy = double(c[1]) - d[1], cdz = double(c[2]) - d[2];
+
+    const double bdxcdy = Detail::NoContract(bdx * cdy), cdxbdy = Detail::NoContract(cdx * bdy);
+    const double cdxady = Detail::NoContract(cdx * ady), adxcdy = Detail::NoContract(adx * cdy);
+    const double adxbdy = Detail::NoContract(adx * bdy), bdxady = Detail::NoContract(bdx * ady);
+
+    const double det = Detail::NoContract(adz * (bdxcdy - cdxbdy)) +
+                       Detail::NoContract(bdz * (cdxady - adxcdy)) +
+                       Detail::NoContract(cdz * (adxbdy - bdxady));
+
+    const double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * std::abs(adz) +
+                             (std::abs(cdxady) + std::abs(adxcdy)) * std::abs(bdz) +
+                             (std::abs(adxbdy) + std::abs(bdxady)) * std::abs(cdz);
+    const double errbound = Detail::O3dErrBound * permanent;
+    if (det > errbound || -det > errbound)
+        return det;
+
+    const double pa[3] = {a[0], a[1], a[2]}, pb[3] = {b[0], b[1], b[2]};
+    const double pc[3] = {c[0], c[1], c[2]}, pd[3] = {d[0], d[1], d[2]};
+    return Detail::ExactOrient3D(pa, pb, pc, pd).Sign();
+}
+
+// 球内判定：a, b, c, d 满足 Orient3D > 0 时，e 在外接球内为正、球外为负、球面上为零（符号精确）
+// 精确路径需要约 200KB 栈空间
+template <Detail::PredicateScalar T>
+double InSphere(const Vec<T, 3> &a, const Vec<T, 3> &b, const Vec<T, 3> &c, const Vec<T, 3> &d, const Vec<T, 3> &e)
+{
+    const double aex = double(a[0]) - e[0], aey = double(a[1]) - e[1], aez = double(a[2]) - e[2];
+    const double bex = double(b[0]) - e[0], bey = double(b[1]) - e[1], bez = double(b[2]) - e[2];
+    const double cex = double(c[0]) - e[0], cey = double(c[1]) - e[1], cez = double(c[2]) - e[2];
+    const double dex = double(d[0]) - e[0], dey = double(d[1]) - e[1], dez = double(d[2]) - e[2];
+
+    auto mul = [](double x, double y)
+    { return Detail::NoContract(x * y); };
+
+    const double aexbey = mul(aex, bey), bexaey = mul(bex, aey), ab = aexbey - bexaey;
+    const double bexcey = mul(bex, cey), cexbey = mul(cex, bey), bc = bexcey - cexbey;
+    const double cexdey = mul(cex, dey), dexcey = mul(dex, cey), cd = cexdey - dexcey;
+    const double dexaey = mul(dex, aey), aexdey = mul(aex, dey), da = dexaey - aexdey;
+    const double aexcey = mul(aex, cey), cexaey = mul(cex, aey), ac = aexcey - cexaey;
+    const double bexdey = mul(bex, dey), dexbey = mul(dex, bey), bd = bexdey - dexbey;
+
+    const double abc = mul(aez, bc) - mul(bez, ac) + mul(cez, ab);
+    const double bcd = mul(bez, cd) - mul(cez, bd) + mul(dez, bc);
+    const double cda = mul(cez, da) + mul(dez, ac) + mul(aez, cd);
+    const double dab = mul(dez, ab) + mul(aez, bd) + mul(bez, da);
+
+    const double alift = mul(aex, aex) + mul(aey, aey) + mul(aez, aez);
+    const double blift = mul(bex, bex) + mul(bey, bey) + mul(bez, bez);
+    const double clift = mul(cex, cex) + mul(cey, cey) + mul(cez, cez);
+    const double dlift = mul(dex, dex) + mul(dey, dey) + mul(dez, dez);
+
+    const double det = (mul(dlift, abc) - mul(clift, dab)) + (mul(blift, cda) - mul(alift, bcd));
+
+    const double aezplus = std::abs(aez), bezplus = std::abs(bez);
+    const double cezplus = std::abs(cez), dezplus = std::abs(dez);
+    const double abxy = std::abs(aexbey) + std::abs(bexaey);
+    const double bcxy = std::abs(bexcey) + std::abs(cexbey);
+    const double cdxy = std::abs(cexdey) + std::abs(dexcey);
+    const double daxy = std::abs(dexaey) + std::abs(aexdey);
+    const double acxy = std::abs(aexcey) + std::abs(cexaey);
+    const double bdxy = std::abs(bexdey) + std::abs(dexbey);
+    const double permanent = ((cdxy * bezplus + bdxy * cezplus + bcxy * dezplus) * alift +
+                              (daxy * cezplus + acxy * dezplus + cdxy * aezplus) * blift +
+                              (abxy * dezplus + bdxy * aezplus + daxy * bezplus) * clift +
+                              (bcxy * aezplus + acxy * bezplus + abxy * cezplus) * dlift);
+    const double errbound = Detail::IspErrBound * permanent;
+    if (det > errbound || -det > errbound)
+        return det;
+
+    // 精确路径：5x5 行列式 |p |p|^2 1| 沿提升列展开
+    const double pa[3] = {a[0], a[1], a[2]}, pb[3] = {b[0], b[1], b[2]};
+    const double pc[3] = {c[0], c[1], c[2]}, pd[3] = {d[0], d[1], d[2]};
+    const double pe[3] = {e[0], e[1], e[2]};
+
+    auto ta = Detail::ExpansionNegate(Detail::ExactLiftScale(Detail::ExactOrient3D(pb, pc, pd, pe), pa));
+    auto tb = Detail::ExactLiftScale(Detail::ExactOrient3D(pa, pc, pd, pe), pb);
+    auto tc = Detail::ExpansionNegate(Detail::ExactLiftScale(Detail::ExactOrient3D(pa, pb, pd, pe), pc));
+    auto td = Detail::ExactLiftScale(Detail::ExactOrient3D(pa, pb, pc, pe), pd);
+    auto te = Detail::ExpansionNegate(Detail::ExactLiftScale(Detail::ExactOrient3D(pa, pb, pc, pd), pe));
+    return Detail::ExpansionSum(Detail::ExpansionSum(Detail::ExpansionSum(ta, tb), Detail::ExpansionSum(tc, td)), te).Sign();
+}
+
+#endif // PREDICATES_HPP
@@ -1,8 +1,15 @@
 #ifndef RANGE_HPP
 #define RANGE_HPP
 
+#include <array>
+#include <cmath>
 #include <concepts>
 #include <iterator>
+#include <list>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <typeinfo>
 #include <vector>
 #include <type_traits>
 
@@ -13,34 +20,54 @@ namespace Detail {
 
 // 范围类
 template <Detail::NumericRange T>
-struct Range final {
+struct Range final : std::ranges::view_interface<Range<T>> {
 private:
 //数据
     T _start, _end, _step; 
 
+    // 第 i 个取值是否仍在范围内
+    constexpr bool contains_index(size_t i) const {
+        T value = static_cast<T>(_start + static_cast<T>(i) * _step);
+        return (_step > 0) ? value < _end : value > _end;
+    }
+
 public:
     //构造
     constexpr Range(T s, T e, T st) : _start(s), _end(e), _step(st) {} 
     constexpr Range(T s, T e) : _start(s), _end(e), _step(static_cast<T>(1)) {} 
     
-    // 迭代器
+    // 迭代器：按下标计算 start + i * step，浮点范围不累积误差，迭代次数与 size() 一致；
+    // 满足 std::random_access_iterator，可直接接入 std::views
     struct Iterator {
-        using iterator_category = std::forward_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
         using value_type = T;
-        T current_value, end_value, step_value;
+        using difference_type = std::ptrdiff_t;
+        T start_value{}, step_value{};
+        size_t index = 0;
 
-        constexpr T operator*() const { return current_value; }
-        constexpr Iterator& operator++() { current_value += step_value; return *this; }
-        
-        constexpr bool operator==(const Iterator& other) const {
-            if (step_value > 0) return current_value >= end_value; // 正向越界判定
-            return current_value <= end_value; // 负向越界判定
+        constexpr T operator*() const { return static_cast<T>(start_value + static_cast<T>(index) * step_value); }
+        constexpr T operator[](difference_type n) const { return *(*this + n); }
+
+        constexpr Iterator& operator++() { ++index; return *this; }
+        constexpr Iterator operator++(int) { Iterator old = *this; ++index; return old; }
+        constexpr Iterator& operator--() { --index; return *this; }
+        constexpr Iterator operator--(int) { Iterator old = *this; --index; return old; }
+        constexpr Iterator& operator+=(difference_type n) { index += n; return *this; }
+        constexpr Iterator& operator-=(difference_type n) { index -= n; return *this; }
+
+        friend constexpr Iterator operator+(Iterator it, difference_type n) { return it += n; }
+        friend constexpr Iterator operator+(difference_type n, Iterator it) { return it += n; }
+        friend constexpr Iterator operator-(Iterator it, difference_type n) { return it -= n; }
+        friend constexpr difference_type operator-(const Iterator& a, const Iterator& b) {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
         }
-        constexpr bool operator!=(const Iterator& other) const { return !(*this == other); }
+        
+        constexpr bool operator==(const Iterator& other) const { return index == other.index; }
+        constexpr auto operator<=>(const Iterator& other) const { return index <=> other.index; }
     };
 
-    constexpr Iterator begin() const { return Iterator{_start, _end, _step}; }
-    constexpr Iterator end() const { return Iterator{_end, _end, _step}; }
+    constexpr Iterator begin() const { return Iterator{_start, _step, 0}; }
+    constexpr Iterator end() const { return Iterator{_start, _step, size()}; }
     
     //数据转换
     template<Detail::NumericRange U,size_t N>
@@ -79,9 +106,25 @@ public:
 
         auto diff = (_step > 0) ? (_end - _start) : (_start - _end); //
         auto abs_step = (_step > 0) ? _step : -_step; //
-        return static_cast<size_t>((diff + abs_step - static_cast<T>(1)) / abs_step); //
+        if constexpr (std::is_floating_point_v<T>) {
+            // 商只作初值，再按迭代器的取值公式修正，保证与实际迭代次数一致
+            size_t n = static_cast<size_t>(diff / abs_step);
+            while (n > 0 && !contains_index(n - 1)) --n;
+            while (contains_index(n)) ++n;
+            return n;
+        } else {
+            return static_cast<size_t>((diff + abs_step - static_cast<T>(1)) / abs_step); //
+        }
     }
 
+    constexpr T operator[](size_t index) const { return static_cast<T>(_start + static_cast<T>(index) * _step); }
+
+    constexpr T start() const noexcept { return _start; }
+
+    constexpr T end_value() const noexcept { return _end; }
+
+    constexpr T step() const noexcept { return _step; }
+
     constexpr const size_t size_in_bytes() const {
         return sizeof(T) * size();
     }
@@ -93,7 +136,7 @@ public:
 
 // 静态范围类
 template <int Start, int End, int Step = 1>
-struct StaticRange final {
+struct StaticRange final : std::ranges::view_interface<StaticRange<Start, End, Step>> {
     static_assert(Step != 0, "Step cannot be zero");
 
     // 编译期计算元素个数
@@ -105,22 +148,151 @@ struct StaticRange final {
         }
     }();
 
+    // 迭代器：按下标计数，end() 的下标为 size，相等比较是真正的等价关系
     struct Iterator {
-        int current;
-        constexpr int operator*() const { return current; }
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        int index = 0;
+        constexpr int operator*() const { return Start + index * Step; }
         constexpr Iterator& operator++() { 
-            current += Step; 
+            ++index; 
             return *this; 
         }
+        constexpr Iterator operator++(int) { Iterator old = *this; ++index; return old; }
         
-        constexpr bool operator!=(const Iterator& other) const { 
-            if constexpr (Step > 0) return current < other.current;
-            else return current > other.current;
+        constexpr bool operator==(const Iterator& other) const { return index == other.index; }
+        constexpr bool operator!=(const Iterator& other) const { return !(*this == other); }
+    };
+
+    constexpr Iterator begin() const { return Iterator{0}; }
+    constexpr Iterator end() const { return Iterator{size}; }
+};
+
+// 等分采样：[start, stop] 上 count 个点（endpoint 为 false 时不含 stop），
+// 每个值由下标直接计算，末点精确等于 stop
+template <std::floating_point T>
+struct Linspace final : std::ranges::view_interface<Linspace<T>> {
+private:
+    // 数据
+    T _start, _stop, _step;
+    size_t _count;
+    bool _endpoint;
+
+public:
+    // 构造
+    constexpr Linspace(T start, T stop, size_t count, bool endpoint = true)
+        : _start(start), _stop(stop), _step(0), _count(count), _endpoint(endpoint) {
+        size_t intervals = endpoint ? (count > 1 ? count - 1 : 1) : (count > 0 ? count : 1);
+        _step = (stop - start) / static_cast<T>(intervals);
+    }
+
+    // 访问
+    constexpr T operator[](size_t index) const {
+        if (_endpoint && index + 1 == _count && _count > 1) return _stop;
+        return _start + static_cast<T>(index) * _step;
+    }
+
+    // 迭代器
+    struct Iterator {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        const Linspace* space = nullptr;
+        size_t index = 0;
+
+        constexpr T operator*() const { return (*space)[index]; }
+        constexpr Iterator& operator++() { ++index; return *this; }
+        constexpr Iterator operator++(int) { Iterator old = *this; ++index; return old; }
+        constexpr bool operator==(const Iterator& other) const { return index == other.index; }
+        constexpr bool operator!=(const Iterator& other) const { return !(*this == other); }
+    };
+
+    constexpr Iterator begin() const { return Iterator{this, 0}; }
+    constexpr Iterator end() const { return Iterator{this, _count}; }
+
+    // 批量生成：循环体无依赖，编译器可向量化
+    void Fill(std::span<T> out) const {
+        if (out.size() != _count) {
+            throw std::runtime_error("Linspace span size mismatch");
+        }
+        const T start = _start, step = _step;
+        for (size_t i = 0; i < _count; ++i) {
+            out[i] = start + static_cast<T>(i) * step;
         }
+        if (_endpoint && _count > 1) out[_count - 1] = _stop;
+    }
+
+    //数据转换
+    template<Detail::NumericRange U>
+    operator std::vector<U>() const {
+        std::vector<T> values(_count);
+        Fill(values);
+        return std::vector<U>(values.begin(), values.end());
+    }
+
+    //查询方法
+    constexpr T step() const noexcept { return _step; }
+
+    constexpr size_t size() const noexcept { return _count; }
+
+    constexpr size_t size_in_bytes() const noexcept { return sizeof(T) * _count; }
+};
+
+// 对数采样：base 的 Linspace(start, stop, count) 次幂
+template <std::floating_point T>
+struct Logspace final : std::ranges::view_interface<Logspace<T>> {
+private:
+    // 数据
+    Linspace<T> _exponents;
+    T _base;
+
+public:
+    // 构造
+    constexpr Logspace(T start, T stop, size_t count, T base = static_cast<T>(10), bool endpoint = true)
+        : _exponents(start, stop, count, endpoint), _base(base) {}
+
+    // 访问
+    T operator[](size_t index) const { return std::pow(_base, _exponents[index]); }
+
+    // 迭代器
+    struct Iterator {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        const Logspace* space = nullptr;
+        size_t index = 0;
+
+        T operator*() const { return (*space)[index]; }
+        constexpr Iterator& operator++() { ++index; return *this; }
+        constexpr Iterator operator++(int) { Iterator old = *this; ++index; return old; }
+        constexpr bool operator==(const Iterator& other) const { return index == other.index; }
+        constexpr bool operator!=(const Iterator& other) const { return !(*this == other); }
     };
 
-    constexpr Iterator begin() const { return Iterator{Start}; }
-    constexpr Iterator end() const { return Iterator{End}; }
+    constexpr Iterator begin() const { return Iterator{this, 0}; }
+    constexpr Iterator end() const { return Iterator{this, _exponents.size()}; }
+
+    // 批量生成：先生成指数，再逐元素求幂；与 operator[] 使用同一公式，结果逐位一致，末点为 pow(base, stop)
+    void Fill(std::span<T> out) const {
+        _exponents.Fill(out);
+        for (auto &value : out) {
+            value = std::pow(_base, value);
+        }
+    }
+
+    //数据转换
+    template<Detail::NumericRange U>
+    operator std::vector<U>() const {
+        std::vector<T> values(size());
+        Fill(values);
+        return std::vector<U>(values.begin(), values.end());
+    }
+
+    //查询方法
+    constexpr size_t size() const noexcept { return _exponents.size(); }
+
+    constexpr size_t size_in_bytes() const noexcept { return sizeof(T) * size(); }
 };
 
 template<typename T> Range(T, T) -> Range<T>;
@@ -0,0 +1,356 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include "vec.hpp"
+#include "mat.hpp"
+
+#ifndef REFERENCE_HPP
+#define REFERENCE_HPP
+
+// 误差统计：逐元素相对误差（参考值为 0 时取绝对误差）与按范数的相对误差
+// ||approx - exact||_F / ||exact||_F（每个结果一次）的最大值与平均值
+struct AccuracyStats final
+{
+    double max_rel = 0;
+    double sum_rel = 0;
+    std::size_t count = 0;
+    double max_norm = 0;
+    double sum_norm = 0;
+    std::size_t results = 0;
+
+    void Add(double rel)
+    {
+        max_rel = std::max(max_rel, rel);
+        sum_rel += rel;
+        ++count;
+    }
+
+    void AddNorm(double rel)
+    {
+        max_norm = std::max(max_norm, rel);
+        sum_norm += rel;
+        ++results;
+    }
+
+    // 查询方法
+    double mean_rel() const noexcept { return count ? sum_rel / static_cast<double>(count) : 0.0; }
+
+    double mean_norm() const noexcept { return results ? sum_norm / static_cast<double>(results) : 0.0; }
+};
+
+// 精度与耗时：每个加速都应附带它所消耗的精度
+struct AccuracyReport final
+{
+    AccuracyStats error;
+    double seconds_per_call = 0;
+};
+
+namespace Detail
+{
+    // splitmix64：生成可复现的测试矩阵
+    inline std::uint64_t SplitMix64(std::uint64_t &state)
+    {
+        std::uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    inline double RelativeError(long double approx, long double exact)
+    {
+        const long double abs_err = std::abs(approx - exact);
+        return static_cast<double>(exact != 0 ? abs_err / std::abs(exact) : abs_err);
+    }
+
+    // 累加误差：标量、向量与矩阵；向量与矩阵逐元素累加，并按 Frobenius 范数整体累加一次
+    template <typename T, typename R>
+        requires std::is_arithmetic_v<T>
+    void AddError(AccuracyStats &stats, const T &approx, const R &exact)
+    {
+        const double rel = RelativeError(static_cast<long double>(approx), static_cast<long double>(exact));
+        stats.Add(rel);
+        stats.AddNorm(rel);
+    }
+
+    // Vec 与 Mat 都支持按线性下标访问
+    template <typename A, typename E>
+    void AddElementErrors(AccuracyStats &stats, const A &approx, const E &exact, size_t count)
+    {
+        long double diff = 0, norm = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const long double a = static_cast<long double>(approx[i]), e = static_cast<long double>(exact[i]);
+            stats.Add(RelativeError(a, e));
+            diff += (a - e) * (a - e);
+            norm += e * e;
+        }
+        stats.AddNorm(static_cast<double>(norm > 0 ? std::sqrt(diff / norm) : std::sqrt(diff)));
+    }
+
+    template <typename T, typename R, size_t N>
+    void AddError(AccuracyStats &stats, const Vec<T, N> &approx, const Vec<R, N> &exact)
+    {
+        AddElementErrors(stats, approx, exact, N);
+    }
+
+    template <typename T, typename R, size_t Row, size_t Col>
+    void AddError(AccuracyStats &stats, const Mat<T, Row, Col> &approx, const Mat<R, Row, Col> &exact)
+    {
+        AddElementErrors(stats, approx, exact, Row * Col);
+    }
+
+    // 参考实现的默认相对容差：主元 / 秩判定的阈值为 tolerance * max|a_ij|
+    inline constexpr long double ReferenceTolerance = 1e-12L;
+
+    // 部分主元 LU（long double），返回置换符号；主元不超过 tolerance * max|a_ij|（原矩阵）时 singular 置为 true，
+    // 与 ReferenceRank 的判定一致，舍入后残留的微小主元不会被当作非奇异
+    template <size_t Size>
+    int ReferenceLU(Mat<long double, Size, Size> &a, std::array<size_t, Size> &perm, bool &singular,
+                    long double tolerance = ReferenceTolerance)
+    {
+        long double scale = 0;
+        for (size_t i = 0; i < Size * Size; ++i)
+            scale = std::max(scale, std::abs(a[i]));
+        const long double threshold = tolerance * scale;
+        int sign = 1;
+        singular = false;
+        for (size_t i = 0; i < Size; ++i)
+            perm[i] = i;
+        for (size_t k = 0; k < Size; ++k)
+        {
+            size_t pivot = k;
+            for (size_t i = k + 1; i < Size; ++i)
+                if (std::abs(a[i, k]) > std::abs(a[pivot, k]))
+                    pivot = i;
+            if (std::abs(a[pivot, k]) <= threshold)
+            {
+                singular = true;
+                continue;
+            }
+            if (pivot != k)
+            {
+                for (size_t j = 0; j < Size; ++j)
+                    std::swap(a[k, j], a[pivot, j]);
+                std::swap(perm[k], perm[pivot]);
+                sign = -sign;
+            }
+            for (size_t i = k + 1; i < Size; ++i)
+            {
+                const long double factor = a[i, k] / a[k, k];
+                a[i, k] = factor;
+                for (size_t j = k + 1; j < Size; ++j)
+                    a[i, j] -= factor * a[k, j];
+            }
+        }
+        return sign;
+    }
+}
+
+// 测试矩阵
+// Hilbert 矩阵 H[i, j] = 1 / (i + j + 1)：条件数随阶数指数增长（8 阶约 1.5e10）
+template <Detail::NumericMat T, size_t Size>
+constexpr Mat<T, Size, Size> MakeHilbert()
+{
+    Mat<T, Size, Size> result;
+    for (size_t i = 0; i < Size; ++i)
+        for (size_t j = 0; j < Size; ++j)
+            result[i, j] = T(1) / static_cast<T>(i + j + 1);
+    return result;
+}
+
+// 元素在 [lo, hi) 上均匀分布的随机矩阵，相同 seed 得到相同结果
+template <std::floating_point T, size_t Row, size_t Col>
+Mat<T, Row, Col> MakeRandom(std::uint64_t seed, T lo = T(-1), T hi = T(1))
+{
+    Mat<T, Row, Col> result;
+    for (size_t i = 0; i < Row * Col; ++i)
+    {
+        const double u = static_cast<double>(Detail::SplitMix64(seed) >> 11) * 0x1.0p-53;
+        result[i] = lo + static_cast<T>(u) * (hi - lo);
+    }
+    return result;
+}
+
+// 秩为 Size - 1 的随机奇异矩阵：最后一行是前两行之和（Size 为 1 时为零矩阵）
+template <std::floating_point T, size_t Size>
+Mat<T, Size, Size> MakeSingular(std::uint64_t seed)
+{
+    auto result = MakeRandom<T, Size, Size>(seed);
+    for (size_t j = 0; j < Size; ++j)
+    {
+        if constexpr (Size == 1)
+            result[0, j] = T(0);
+        else if constexpr (Size == 2)
+            result[1, j] = result[0, j];
+        else
+            result[Size - 1, j] = result[0, j] + result[1, j];
+    }
+    return result;
+}
+
+// 参考实现：全部以 long double 计算，作为优化版本的对照
+template <Detail::NumericMat T, size_t Row, size_t Col, size_t OtherCol>
+Mat<long double, Row, OtherCol> ReferenceMultiply(const Mat<T, Row, Col> &lhs, const Mat<T, Col, OtherCol> &rhs)
+{
+    Mat<long double, Row, OtherCol> result;
+    for (size_t i = 0; i < Row; ++i)
+    {
+        for (size_t j = 0; j < OtherCol; ++j)
+        {
+            long double sum = 0;
+            for (size_t k = 0; k < Col; ++k)
+                sum += static_cast<long double>(lhs[i, k]) * static_cast<long double>(rhs[k, j]);
+            result[i, j] = sum;
+        }
+    }
+    return result;
+}
+
+// 按相对主元容差判定奇异时返回 0
+template <Detail::NumericMat T, size_t Size>
+long double ReferenceDet(const Mat<T, Size, Size> &mat, long double tolerance = Detail::ReferenceTolerance)
+{
+    Mat<long double, Size, Size> a(mat);
+    std::array<size_t, Size> perm;
+    bool singular = false;
+    long double det = Detail::ReferenceLU(a, perm, singular, tolerance);
+    if (singular)
+        return 0;
+    for (size_t i = 0; i < Size; ++i)
+        det *= a[i, i];
+    return det;
+}
+
+// 按相对主元容差判定奇异时抛出异常
+template <Detail::NumericMat T, size_t Size>
+Mat<long double, Size, Size> ReferenceInverse(const Mat<T, Size, Size> &mat,
+                                              long double tolerance = Detail::ReferenceTolerance)
+{
+    Mat<long double, Size, Size> a(mat);
+    std::array<size_t, Size> perm;
+    bool singular = false;
+    Detail::ReferenceLU(a, perm, singular, tolerance);
+    if (singular)
+    {
+        throw std::runtime_error("Matrix is singular and cannot be inverted.");
+    }
+    // 逐列解 L U x = P e_j
+    Mat<long double, Size, Size> inv;
+    for (size_t j = 0; j < Size; ++j)
+    {
+        std::array<long double, Size> x{};
+        for (size_t i = 0; i < Size; ++i)
+        {
+            long double sum = perm[i] == j ? 1.0L : 0.0L;
+            for (size_t k = 0; k < i; ++k)
+                sum -= a[i, k] * x[k];
+            x[i] = sum;
+        }
+        for (size_t i = Size; i-- > 0;)
+        {
+            long double sum = x[i];
+            for (size_t k = i + 1; k < Size; ++k)
+                sum -= a[i, k] * x[k];
+            x[i] = sum / a[i, i];
+        }
+        for (size_t i = 0; i < Size; ++i)
+            inv[i, j] = x[i];
+    }
+    return inv;
+}
+
+// 全主元消元求秩，容差相对于最大元素：tolerance * max|a_ij|
+template <Detail::NumericMat T, size_t Row, size_t Col>
+size_t ReferenceRank(const Mat<T, Row, Col> &mat, long double tolerance = Detail::ReferenceTolerance)
+{
+    Mat<long double, Row, Col> a(mat);
+    long double scale = 0;
+    for (size_t i = 0; i < Row * Col; ++i)
+        scale = std::max(scale, std::abs(a[i]));
+    const long double threshold = tolerance * scale;
+    std::array<bool, Row> row_used{};
+    std::array<bool, Col> col_used{};
+    size_t rank = 0;
+    while (rank < std::min(Row, Col))
+    {
+        size_t pr = Row, pc = Col;
+        long double best = threshold;
+        for (size_t i = 0; i < Row; ++i)
+            for (size_t j = 0; j < Col; ++j)
+                if (!row_used[i] && !col_used[j] && std::abs(a[i, j]) > best)
+                {
+                    best = std::abs(a[i, j]);
+                    pr = i;
+                    pc = j;
+                }
+        if (pr == Row)
+            break;
+        row_used[pr] = col_used[pc] = true;
+        ++rank;
+        for (size_t i = 0; i < Row; ++i)
+        {
+            if (row_used[i])
+                continue;
+            const long double factor = a[i, pc] / a[pr, pc];
+            for (size_t j = 0; j < Col; ++j)
+                a[i, j] -= factor * a[pr, j];
+        }
+    }
+    return rank;
+}
+
+template <Detail::NumericVec T, size_t N>
+Vec<long double, N> ReferenceNormalize(const Vec<T, N> &v)
+{
+    long double sum = 0;
+    for (size_t i = 0; i < N; ++i)
+        sum += static_cast<long double>(v[i]) * static_cast<long double>(v[i]);
+    Vec<long double, N> result;
+    if (sum > 0)
+    {
+        const long double len = std::sqrt(sum);
+        for (size_t i = 0; i < N; ++i)
+            result[i] = static_cast<long double>(v[i]) / len;
+    }
+    return result;
+}
+
+// 误差度量：approx 与参考值 exact 逐元素比较，并给出按范数的相对误差
+template <typename T, typename R>
+AccuracyStats RelativeError(const T &approx, const R &exact)
+{
+    AccuracyStats stats;
+    Detail::AddError(stats, approx, exact);
+    return stats;
+}
+
+// 对每个输入比较 fast(input) 与 reference(input) 的误差，并测量 fast 的平均耗时（每个输入重复 repeats 次）
+template <typename Inputs, typename Fast, typename Reference>
+AccuracyReport MeasureAccuracy(const Inputs &inputs, Fast fast, Reference reference, std::size_t repeats = 1)
+{
+    AccuracyReport report;
+    std::size_t calls = 0;
+    double seconds = 0;
+    for (const auto &input : inputs)
+    {
+        const auto exact = reference(input);
+        const auto start = std::chrono::steady_clock::now();
+        auto approx = fast(input);
+        for (std::size_t r = 1; r < repeats; ++r)
+            approx = fast(input);
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        calls += std::max<std::size_t>(repeats, 1);
+        Detail::AddError(report.error, approx, exact);
+    }
+    report.seconds_per_call = calls ? seconds / static_cast<double>(calls) : 0.0;
+    return report;
+}
+
+#endif // REFERENCE_HPP
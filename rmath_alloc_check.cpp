@@ -0,0 +1,143 @@
+// rmath_alloc_check：替换全局 operator new / delete 并计数，检查固定尺寸 Vec / Mat 的常用运算不做堆分配
+// 每项先预热一次（定义 RMATH_TRACE 时首次记录会分配本线程的追踪缓冲），再计数重复调用
+// 用法：rmath_alloc_check；任一运算发生分配时返回非零
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include "vec.hpp"
+#include "mat.hpp"
+
+using namespace std;
+
+namespace {
+
+size_t g_allocations = 0;
+
+void *Allocate(size_t size)
+{
+    ++g_allocations;
+    if (void *p = malloc(size ? size : 1))
+        return p;
+    throw bad_alloc();
+}
+
+void *AllocateAligned(size_t size, align_val_t align)
+{
+    ++g_allocations;
+    const size_t alignment = static_cast<size_t>(align);
+    // aligned_alloc 要求大小是对齐的整数倍
+    if (void *p = aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment))
+        return p;
+    throw bad_alloc();
+}
+
+} // namespace
+
+// 全局替换：所有形式的 new 都计数，delete 与之配对释放
+void *operator new(size_t size) { return Allocate(size); }
+void *operator new[](size_t size) { return Allocate(size); }
+void *operator new(size_t size, align_val_t align) { return AllocateAligned(size, align); }
+void *operator new[](size_t size, align_val_t align) { return AllocateAligned(size, align); }
+void *operator new(size_t size, const nothrow_t &) noexcept
+{
+    ++g_allocations;
+    return malloc(size ? size : 1);
+}
+void *operator new[](size_t size, const nothrow_t &) noexcept
+{
+    ++g_allocations;
+    return malloc(size ? size : 1);
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+void operator delete(void *p, align_val_t) noexcept { free(p); }
+void operator delete[](void *p, align_val_t) noexcept { free(p); }
+void operator delete(void *p, size_t, align_val_t) noexcept { free(p); }
+void operator delete[](void *p, size_t, align_val_t) noexcept { free(p); }
+void operator delete(void *p, const nothrow_t &) noexcept { free(p); }
+void operator delete[](void *p, const nothrow_t &) noexcept { free(p); }
+
+namespace {
+
+int g_failures = 0;
+volatile double g_sink = 0;
+
+// 读出结果，防止整个调用被优化掉
+template <typename T>
+void Keep(const T &value)
+{
+    if constexpr (requires { value[0]; })
+        g_sink = g_sink + static_cast<double>(value[0]);
+    else
+        g_sink = g_sink + static_cast<double>(value);
+}
+
+template <typename F>
+void Check(const char *name, F &&fn)
+{
+    Keep(fn());
+    const size_t before = g_allocations;
+    for (int i = 0; i < 100; ++i)
+        Keep(fn());
+    const size_t count = g_allocations - before;
+    printf("%-24s %zu allocations\n", name, count);
+    if (count != 0)
+        ++g_failures;
+}
+
+template <typename T, size_t Row, size_t Col>
+Mat<T, Row, Col> Sample(unsigned seed)
+{
+    Mat<T, Row, Col> m;
+    for (size_t i = 0; i < Row * Col; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        m[i] = static_cast<T>(seed >> 8) / static_cast<T>(1u << 24) - T(0.5);
+    }
+    // 对角占优，保证可逆
+    for (size_t i = 0; i < Row && i < Col; ++i)
+        m[i, i] += T(Col);
+    return m;
+}
+
+} // namespace
+
+int main() {
+    const auto a = Sample<double, 4, 4>(1), b = Sample<double, 4, 4>(2);
+    const auto big = Sample<double, 8, 8>(3);
+    const auto wide = Sample<double, 3, 5>(4);
+    const auto ints = Sample<double, 5, 5>(5);
+    Mat<long long, 5, 5> integral;
+    for (size_t i = 0; i < 25; ++i)
+        integral[i] = static_cast<long long>(ints[i] * 8);
+    Vec<double, 4> u, v;
+    for (size_t i = 0; i < 4; ++i) {
+        u[i] = 0.5 + static_cast<double>(i);
+        v[i] = 1.5 - static_cast<double>(i);
+    }
+
+    Check("Vec +", [&] { return u + v; });
+    Check("Vec -", [&] { return u - v; });
+    Check("Vec * scalar", [&] { return u * 3.0; });
+    Check("Dot", [&] { return Dot(u, v); });
+    Check("Length", [&] { return Length(u); });
+    Check("Normalize", [&] { return Normalize(u); });
+    Check("Mat +", [&] { return a + b; });
+    Check("Mat -", [&] { return a - b; });
+    Check("Mat * scalar", [&] { return a * 2.0; });
+    Check("Mat * Mat", [&] { return a * b; });
+    Check("Mat * Vec", [&] { return a * u; });
+    Check("Transpose", [&] { return Transpose(wide); });
+    Check("Det 4x4", [&] { return Det(a); });
+    Check("Det integral 5x5", [&] { return Det(integral); });
+    Check("Inverse 4x4", [&] { return Inverse(a); });
+    Check("Inverse 8x8", [&] { return Inverse(big); });
+    Check("Inverse integral 5x5", [&] { return Inverse(integral); });
+    Check("Rank 3x5", [&] { return static_cast<double>(Rank(wide)); });
+    Check("Rank 8x8", [&] { return static_cast<double>(Rank(big)); });
+
+    printf("%s\n", g_failures ? "FAIL" : "PASS");
+    return g_failures ? 1 : 0;
+}
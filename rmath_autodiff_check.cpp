@@ -0,0 +1,183 @@
+// rmath_autodiff_check：用中心差分核对前向模式 Gradient / Jacobian、反向模式 Tape::Gradient
+// 与 Inverse(Mat<Dual>) 的导数，并比较三种求导方式的耗时
+// 用法：rmath_autodiff_check [随机点数 = 200]；任一相对误差超过容差时返回非零
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include "autodiff.hpp"
+
+using namespace std;
+
+namespace {
+
+constexpr size_t N = 3;
+
+// 被测函数：对 double、Dual、Var 使用同一份代码
+template <typename S>
+S Scalar(const Vec<S, N> &x)
+{
+    using std::cos, std::exp, std::log, std::sin, std::sqrt;
+    const S one(1.0);
+    return sin(x[0]) * exp(x[1] * x[2]) + sqrt(x[0] * x[0] + x[1] * x[1] + one) / (x[2] * x[2] + one) +
+           log(x[1] * x[1] + one) * cos(x[0] - x[2]);
+}
+
+template <typename S>
+Vec<S, 2> Vector(const Vec<S, N> &x)
+{
+    using std::cos, std::exp, std::sin;
+    Vec<S, 2> y;
+    y[0] = x[0] * x[1] * x[2] + sin(x[0] * x[1]);
+    y[1] = exp(x[0] - x[2]) / (x[1] * x[1] + S(1.0)) + cos(x[2]);
+    return y;
+}
+
+// 中心差分：步长 eps^(1/3) * max(1, |x_i|)，截断误差与舍入误差大致平衡
+template <typename F>
+auto CentralDifference(F f, Vec<double, N> x, size_t i)
+{
+    const double h = cbrt(numeric_limits<double>::epsilon()) * max(1.0, abs(x[i]));
+    const double xi = x[i];
+    x[i] = xi + h;
+    const auto up = f(x);
+    x[i] = xi - h;
+    const auto down = f(x);
+    return (up - down) / (2 * h);
+}
+
+double Relative(double approx, double exact)
+{
+    return abs(approx - exact) / max(1.0, abs(exact));
+}
+
+template <typename F>
+double Seconds(F &&fn, size_t repeats)
+{
+    const auto start = chrono::steady_clock::now();
+    for (size_t r = 0; r < repeats; ++r)
+        fn();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count() / static_cast<double>(repeats);
+}
+
+// Inverse(Mat<Dual>)：d/dt (A + t B)^-1 与中心差分比较；另检查小尺度可逆矩阵不被误判为奇异、奇异矩阵抛出异常
+double InverseDerivativeError(bool &scale_ok, bool &singular_ok)
+{
+    using D = Dual<double, 1>;
+    const double a[3][3] = {{4, -1, 2}, {1, 3, -2}, {0.5, 2, 5}};
+    const double b[3][3] = {{1, 0.5, -1}, {0, 2, 1}, {-1, 1, 0.5}};
+    Mat<D, 3, 3> dual;
+    for (size_t r = 0; r < 3; ++r)
+        for (size_t c = 0; c < 3; ++c)
+            dual[r, c] = D(a[r][c], {b[r][c]});
+    const auto inverse = Inverse(dual);
+
+    const auto at = [&](double t) {
+        Mat<double, 3, 3> m;
+        for (size_t r = 0; r < 3; ++r)
+            for (size_t c = 0; c < 3; ++c)
+                m[r, c] = a[r][c] + t * b[r][c];
+        return Inverse(m);
+    };
+    const double h = cbrt(numeric_limits<double>::epsilon());
+    const auto difference = (at(h) - at(-h)) * (1 / (2 * h));
+    double error = 0;
+    for (size_t i = 0; i < 9; ++i)
+        error = max(error, Relative(inverse[i].grad(0), difference[i]));
+
+    // diag(2e-6, 3e-6)：|det| = 6e-12，但矩阵完全可逆
+    Mat<D, 2, 2> small;
+    small[0, 0] = D(2e-6, {1.0});
+    small[1, 1] = D(3e-6);
+    const auto small_inverse = Inverse(small);
+    scale_ok = abs(small_inverse[0, 0].value() - 5e5) < 1e-6 && abs(small_inverse[1, 1].value() - 1e6 / 3) < 1e-6 &&
+               abs(small_inverse[0, 0].grad(0) + 2.5e11) < 1;
+
+    Mat<D, 2, 2> singular;
+    singular[0, 0] = D(1.0, {1.0});
+    singular[0, 1] = D(2.0);
+    singular[1, 0] = D(2.0);
+    singular[1, 1] = D(4.0);
+    singular_ok = false;
+    try {
+        (void)Inverse(singular);
+    } catch (const runtime_error &) {
+        singular_ok = true;
+    }
+    return error;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const size_t points = argc > 1 ? static_cast<size_t>(stoull(argv[1])) : 200;
+    // 中心差分本身只有约 eps^(2/3) 的精度
+    const double tolerance = 1e-6;
+
+    double forward_error = 0, reverse_error = 0, jacobian_error = 0;
+    double forward_time = 0, reverse_time = 0, difference_time = 0;
+    uint64_t state = 7;
+    Tape<double> tape;
+    for (size_t p = 0; p < points; ++p) {
+        Vec<double, N> x;
+        for (size_t i = 0; i < N; ++i) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            x[i] = static_cast<double>(state >> 11) * 0x1.0p-53 * 4.0 - 2.0;
+        }
+
+        // 前向模式
+        Vec<double, N> forward;
+        forward_time += Seconds([&] { forward = Gradient([](const auto &v) { return Scalar(v); }, x); }, 16);
+
+        // 反向模式
+        Vec<double, N> reverse;
+        reverse_time += Seconds([&] {
+            tape.Clear();
+            Vec<Var<double>, N> vars;
+            for (size_t i = 0; i < N; ++i)
+                vars[i] = tape.Variable(x[i]);
+            const auto adjoint = tape.Gradient(Scalar(vars));
+            for (size_t i = 0; i < N; ++i)
+                reverse[i] = adjoint[vars[i].index()];
+        }, 16);
+
+        // 中心差分
+        Vec<double, N> difference;
+        difference_time += Seconds([&] {
+            for (size_t i = 0; i < N; ++i)
+                difference[i] = CentralDifference([](const auto &v) { return Scalar(v); }, x, i);
+        }, 16);
+
+        for (size_t i = 0; i < N; ++i) {
+            forward_error = max(forward_error, Relative(forward[i], difference[i]));
+            reverse_error = max(reverse_error, Relative(reverse[i], difference[i]));
+        }
+
+        const auto jacobian = Jacobian([](const auto &v) { return Vector(v); }, x);
+        for (size_t c = 0; c < N; ++c) {
+            const auto column = CentralDifference([](const auto &v) { return Vector(v); }, x, c);
+            for (size_t r = 0; r < 2; ++r)
+                jacobian_error = max(jacobian_error, Relative(jacobian[r, c], column[r]));
+        }
+    }
+
+    const double scale = 1e9 / static_cast<double>(points);
+    printf("Gradient        max rel error %.3e  %8.1f ns\n", forward_error, forward_time * scale);
+    printf("Tape::Gradient  max rel error %.3e  %8.1f ns\n", reverse_error, reverse_time * scale);
+    printf("Jacobian        max rel error %.3e\n", jacobian_error);
+    printf("central diff                          %8.1f ns\n", difference_time * scale);
+
+    bool scale_ok = false, singular_ok = false;
+    const double inverse_error = InverseDerivativeError(scale_ok, singular_ok);
+    printf("Inverse(Dual)   max rel error %.3e  small-scale %s  singular %s\n", inverse_error,
+           scale_ok ? "ok" : "FAILED", singular_ok ? "throws" : "FAILED");
+
+    const bool ok = forward_error < tolerance && reverse_error < tolerance && jacobian_error < tolerance &&
+                    inverse_error < tolerance && scale_ok && singular_ok;
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
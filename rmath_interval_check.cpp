@@ -0,0 +1,115 @@
+// rmath_interval_check：检查 Interval 作为 Mat 元素时 Det / Inverse 的包络性质
+//   1. 点区间矩阵的 Det / Inverse 包含 long double 参考结果；
+//   2. 宽度为 2e-9 的区间矩阵的逆包含其中随机点矩阵的逆；
+//   3. 行列式区间含 0（奇异或在误差内可能奇异）时 Inverse 抛出异常；
+//   4. 无界区间相乘时 0 * inf 取 0，不产生 NaN
+// 用法：rmath_interval_check；任一检查失败时返回非零
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+#include "interval.hpp"
+#include "reference.hpp"
+
+using namespace std;
+
+namespace {
+
+int g_failures = 0;
+
+void Expect(bool ok, const char *name)
+{
+    printf("%-52s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++g_failures;
+}
+
+template <size_t Size>
+Mat<Intervald, Size, Size> Widen(const Mat<double, Size, Size> &m, double radius)
+{
+    Mat<Intervald, Size, Size> result;
+    for (size_t i = 0; i < Size * Size; ++i)
+        result[i] = Intervald(m[i] - radius, m[i] + radius);
+    return result;
+}
+
+template <size_t Size>
+bool Encloses(const Mat<Intervald, Size, Size> &box, const Mat<long double, Size, Size> &value)
+{
+    for (size_t i = 0; i < Size * Size; ++i)
+        if (!box[i].Contains(static_cast<double>(value[i])))
+            return false;
+    return true;
+}
+
+template <size_t Size>
+bool ThrowsOnInverse(const Mat<Intervald, Size, Size> &m)
+{
+    try {
+        (void)Inverse(m);
+    } catch (const runtime_error &) {
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+int main() {
+    // 点区间：区间结果必须包含精确值
+    bool det_ok = true, inverse_ok = true;
+    for (uint64_t seed = 0; seed < 50; ++seed) {
+        const auto m = MakeRandom<double, 4, 4>(seed);
+        const auto box = Widen(m, 0.0);
+        det_ok = det_ok && Det(box).Contains(static_cast<double>(ReferenceDet(m)));
+        inverse_ok = inverse_ok && Encloses(Inverse(box), ReferenceInverse(m));
+    }
+    Expect(det_ok, "Det(point intervals) encloses reference, 50 x 4x4");
+    Expect(inverse_ok, "Inverse(point intervals) encloses reference, 50 x 4x4");
+
+    // 有宽度的区间：区间内任意矩阵的逆都应被包含
+    {
+        const auto center = MakeRandom<double, 3, 3>(7) + Mat<double, 3, 3>::MakeIdentity() * 3.0;
+        const auto enclosure = Inverse(Widen(center, 1e-9));
+        bool ok = true;
+        uint64_t state = 11;
+        for (int sample = 0; sample < 100; ++sample) {
+            auto point = center;
+            for (size_t i = 0; i < 9; ++i) {
+                const double u = static_cast<double>(Detail::SplitMix64(state) >> 11) * 0x1.0p-53;
+                point[i] += (u - 0.5) * 1e-9;
+            }
+            ok = ok && Encloses(enclosure, ReferenceInverse(point));
+        }
+        Expect(ok, "Inverse(width 2e-9) encloses 100 member inverses");
+    }
+
+    // 奇异：点区间精确奇异，以及区间宽度足以包含奇异矩阵
+    {
+        Mat<double, 2, 2> singular;
+        singular[0, 0] = 1;
+        singular[0, 1] = 2;
+        singular[1, 0] = 2;
+        singular[1, 1] = 4;
+        Expect(ThrowsOnInverse(Widen(singular, 0.0)), "Inverse throws on exactly singular 2x2");
+
+        Mat<double, 2, 2> nearly = singular;
+        nearly[1, 1] = 4 + 1e-6;
+        Expect(!ThrowsOnInverse(Widen(nearly, 1e-8)), "Inverse accepts det = 1e-6 at radius 1e-8");
+        Expect(ThrowsOnInverse(Widen(nearly, 1e-6)), "Inverse throws when radius 1e-6 reaches det = 0");
+    }
+
+    // 无界区间乘法：0 * inf 按 0 处理，结果仍是包络而不是 NaN
+    {
+        constexpr double inf = numeric_limits<double>::infinity();
+        const auto p = Intervald(0, 1) * Intervald(-inf, 2);
+        Expect(p.lo() == -inf && p.hi() >= 2, "[0, 1] * [-inf, 2] = [-inf, 2]");
+        const auto q = Intervald(-inf, inf) * Intervald(0);
+        Expect(q.lo() <= 0 && q.hi() >= 0 && q.width() < 1e-300, "[-inf, inf] * [0, 0] = [0, 0]");
+        const auto r = Intervald(-1, 0) * Intervald(3, inf);
+        Expect(r.lo() == -inf && r.hi() >= 0 && r.hi() < 1e-300, "[-1, 0] * [3, inf] = [-inf, 0]");
+    }
+
+    printf("%s\n", g_failures ? "FAIL" : "PASS");
+    return g_failures ? 1 : 0;
+}
@@ -0,0 +1,92 @@
+// rmath_lsq_check：Levenberg–Marquardt 与 Gauss–Newton 的回归检查
+//   1. initial_lambda = 0 时遇到使代价上升的步长，阻尼必须能增大（曾死循环）；
+//   2. 解析雅可比与自动雅可比给出相同的解；
+//   3. Gauss–Newton 在零残差问题上收敛
+// 用法：rmath_lsq_check；任一检查失败时返回非零
+#include <cmath>
+#include <cstdio>
+#include "lsq.hpp"
+
+using namespace std;
+
+namespace {
+
+int g_failures = 0;
+
+void Expect(bool ok, const char *name)
+{
+    printf("%-48s %s\n", name, ok ? "ok" : "FAILED");
+    if (!ok)
+        ++g_failures;
+}
+
+} // namespace
+
+int main() {
+    // r(x) = atan(x)：x = 3 处的纯高斯-牛顿步会越过零点并使代价上升
+    auto atan_residual = [](const Vec<double, 1> &x) {
+        Vec<double, 1> r;
+        r[0] = atan(x[0]);
+        return r;
+    };
+    // r(x) = x / sqrt(1 + x^2)：同样的形状，只用 Dual 支持的运算；x = 3 处高斯-牛顿步为 -x^3
+    auto sigmoid_residual = [](const auto &x) {
+        using std::sqrt;
+        using S = decay_t<decltype(x[0])>;
+        Vec<S, 1> r;
+        r[0] = x[0] / sqrt(S(1.0) + x[0] * x[0]);
+        return r;
+    };
+    auto atan_jacobian = [](const Vec<double, 1> &x) {
+        Mat<double, 1, 1> j;
+        j[0, 0] = 1.0 / (1.0 + x[0] * x[0]);
+        return j;
+    };
+
+    LeastSquaresOptions zero_lambda;
+    zero_lambda.initial_lambda = 0;
+    {
+        Vec<double, 1> x;
+        x[0] = 3;
+        const auto result = LevenbergMarquardt(atan_residual, atan_jacobian, x, zero_lambda);
+        Expect(result.converged && abs(x[0]) < 1e-6, "LM analytic J, initial_lambda = 0, x0 = 3");
+    }
+    {
+        Vec<double, 1> x;
+        x[0] = 3;
+        const auto result = LevenbergMarquardt(sigmoid_residual, x, zero_lambda);
+        Expect(result.converged && abs(x[0]) < 1e-6, "LM auto J, initial_lambda = 0, x0 = 3");
+    }
+    {
+        Vec<double, 1> x;
+        x[0] = 3;
+        const auto result = LevenbergMarquardt(atan_residual, atan_jacobian, x);
+        Expect(result.converged && abs(x[0]) < 1e-6, "LM analytic J, default options, x0 = 3");
+    }
+
+    // Rosenbrock 残差 (10 (y - x^2), 1 - x)：零残差，解为 (1, 1)
+    auto rosenbrock = [](const auto &v) {
+        using S = decay_t<decltype(v[0])>;
+        Vec<S, 2> r;
+        r[0] = S(10.0) * (v[1] - v[0] * v[0]);
+        r[1] = S(1.0) - v[0];
+        return r;
+    };
+    {
+        Vec<double, 2> x;
+        x[0] = -1.2;
+        x[1] = 1;
+        const auto result = GaussNewton(rosenbrock, x);
+        Expect(result.converged && abs(x[0] - 1) < 1e-9 && abs(x[1] - 1) < 1e-9, "Gauss-Newton Rosenbrock");
+    }
+    {
+        Vec<double, 2> x;
+        x[0] = -1.2;
+        x[1] = 1;
+        const auto result = LevenbergMarquardt(rosenbrock, x);
+        Expect(result.converged && abs(x[0] - 1) < 1e-6 && abs(x[1] - 1) < 1e-6, "LM Rosenbrock");
+    }
+
+    printf("%s\n", g_failures ? "FAIL" : "PASS");
+    return g_failures ? 1 : 0;
+}
@@ -0,0 +1,81 @@
+// rmath_numa_bench：比较不同放置策略下的内存带宽（STREAM triad：a[i] = b[i] + s * c[i]）
+// 工作线程按 NumaCpuOrder 绑定，计算与首次触碰使用同一静态划分（StaticParallelFor + FirstTouchAlign）
+//   first-touch：Default 分配 + FirstTouch，每段页落在处理它的线程所在节点
+//   interleaved：按页轮流分布在所有节点
+//   local      ：全部页在调用线程所在节点
+// 用法：rmath_numa_bench [每个数组的元素数 = 1 << 25] [重复次数 = 10]
+// 构建：g++ -std=c++23 -O2 -pthread -DRMATH_USE_LIBNUMA -I. rmath_numa_bench.cpp -lnuma
+//       （不带 libnuma 时三种策略都退化为首次触碰，仅用于冒烟测试）
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include "numa.hpp"
+#include "pool.hpp"
+
+using namespace std;
+
+namespace {
+
+struct Result
+{
+    double gbps;
+    double checksum;
+};
+
+Result Triad(ThreadPool &pool, NumaPlacement placement, bool first_touch, size_t n, int repeats)
+{
+    NumaBuffer<double> a(n, placement), b(n, placement), c(n, placement);
+    constexpr size_t align = FirstTouchAlign<double>();
+    if (first_touch) {
+        FirstTouch(pool, a.span(), 0.0);
+        FirstTouch(pool, b.span(), 1.0);
+        FirstTouch(pool, c.span(), 2.0);
+    } else {
+        // 由调用线程初始化：Local / Interleaved 的页位置已由分配决定
+        fill(a.data(), a.data() + n, 0.0);
+        fill(b.data(), b.data() + n, 1.0);
+        fill(c.data(), c.data() + n, 2.0);
+    }
+
+    const double s = 3.0;
+    double best = 1e300;
+    for (int r = 0; r < repeats; ++r) {
+        const auto start = chrono::steady_clock::now();
+        StaticParallelFor(pool, 0, n, align, [&](size_t first, size_t last) {
+            double *pa = a.data();
+            const double *pb = b.data(), *pc = c.data();
+            for (size_t i = first; i < last; ++i)
+                pa[i] = pb[i] + s * pc[i];
+        });
+        const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+        best = min(best, elapsed.count());
+    }
+    // 三个数组：读 b、c，写 a
+    return {3.0 * static_cast<double>(n * sizeof(double)) / best * 1e-9, a[n / 2]};
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const size_t n = argc > 1 ? static_cast<size_t>(stoull(argv[1])) : size_t{1} << 25;
+    const int repeats = argc > 2 ? stoi(argv[2]) : 10;
+
+    ThreadPool pool;
+    const bool pinned = pool.PinThreads(NumaCpuOrder());
+    printf("nodes %zu, threads %zu%s, %zu doubles per array\n", NumaNodeCount(), pool.size(),
+           pinned ? " (pinned)" : " (not pinned)", n);
+
+    const Result touched = Triad(pool, NumaPlacement::Default, true, n, repeats);
+    const Result interleaved = Triad(pool, NumaPlacement::Interleaved, false, n, repeats);
+    const Result local = Triad(pool, NumaPlacement::Local, false, n, repeats);
+    printf("first-touch  %8.2f GB/s\n", touched.gbps);
+    printf("interleaved  %8.2f GB/s\n", interleaved.gbps);
+    printf("local        %8.2f GB/s\n", local.gbps);
+
+    // 三种策略结果应相同：1 + 3 * 2
+    const bool ok = touched.checksum == 7.0 && interleaved.checksum == 7.0 && local.checksum == 7.0;
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+// rmath_tune：在本机上测量 Gemm 分块、转置块、并行线程数与并行阈值的候选值，写出调优配置文件
+// 用法：rmath_tune [输出文件 = rmath.tune] [矩阵边长 = 512]
+// 运行期通过 ApplyTuneProfile(LoadTuneProfile(path)) 或环境变量 RMATH_TUNE_PROFILE 载入
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gemm.hpp"
+#include "pool.hpp"
+#include "tune.hpp"
+
+using namespace std;
+
+namespace {
+
+// 取多次运行中的最短时间（秒），减少调度噪声
+template <typename F>
+double BestTime(F &&fn, int repeats = 3)
+{
+    double best = 1e300;
+    for (int i = 0; i < repeats; ++i) {
+        const auto start = chrono::steady_clock::now();
+        fn();
+        const chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+        best = min(best, elapsed.count());
+    }
+    return best;
+}
+
+vector<double> RandomMatrix(size_t n, unsigned seed)
+{
+    vector<double> data(n * n);
+    for (auto &x : data) {
+        seed = seed * 1664525u + 1013904223u;
+        x = static_cast<double>(seed >> 8) / static_cast<double>(1u << 24) - 0.5;
+    }
+    return data;
+}
+
+double TimeGemm(size_t n, const vector<double> &a, const vector<double> &b, vector<double> &c,
+                const GemmConfig &config, ThreadPool *pool)
+{
+    MatrixView<const double> va(a.data(), n, n), vb(b.data(), n, n);
+    MatrixView<double> vc(c.data(), n, n);
+    return BestTime([&] {
+        if (pool)
+            Gemm(va, vb, vc, *pool, config);
+        else
+            Gemm(va, vb, vc, config);
+    });
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const string output = argc > 1 ? argv[1] : "rmath.tune";
+    const size_t n = argc > 2 ? static_cast<size_t>(stoull(argv[2])) : 512;
+
+    TuneProfile profile;
+    ApplyTuneProfile(profile);
+
+    const auto a = RandomMatrix(n, 1), b = RandomMatrix(n, 2);
+    vector<double> c(n * n);
+
+    // Gemm 分块（串行测量）
+    double best = 1e300;
+    for (size_t bm : {32, 64, 128}) {
+        for (size_t bn : {128, 256, 512}) {
+            for (size_t bk : {128, 256, 512}) {
+                const GemmConfig config{bm, bn, bk};
+                const double t = TimeGemm(n, a, b, c, config, nullptr);
+                cout << "gemm " << bm << 'x' << bn << 'x' << bk << ": " << 2.0 * n * n * n / t * 1e-9 << " GFLOP/s\n";
+                if (t < best) {
+                    best = t;
+                    profile.gemm = config;
+                }
+            }
+        }
+    }
+
+    // 转置块
+    best = 1e300;
+    for (size_t block : {8, 16, 32, 64, 128}) {
+        const double t = BestTime([&] {
+            Transpose<double>(MatrixView<const double>(a.data(), n, n), MatrixView<double>(c.data(), n, n), block);
+        });
+        cout << "transpose " << block << ": " << t * 1e3 << " ms\n";
+        if (t < best) {
+            best = t;
+            profile.transpose_block = block;
+        }
+    }
+
+    // 并行线程数：threads 限制并行 Gemm 同时处理的行块组数
+    const size_t hardware = max<size_t>(thread::hardware_concurrency(), 1);
+    ThreadPool pool(hardware);
+    profile.parallel_min_flops = 0;
+    best = 1e300;
+    // 候选：2 的幂，再加上 hardware 本身（非 2 的幂的核数不会被漏掉）
+    vector<size_t> thread_candidates;
+    for (size_t threads = 1; threads < hardware; threads *= 2)
+        thread_candidates.push_back(threads);
+    thread_candidates.push_back(hardware);
+    for (size_t threads : thread_candidates) {
+        TuneProfile candidate = profile;
+        candidate.threads = threads;
+        ApplyTuneProfile(candidate);
+        const double t = TimeGemm(n, a, b, c, profile.gemm, &pool);
+        cout << "threads " << threads << ": " << 2.0 * n * n * n / t * 1e-9 << " GFLOP/s\n";
+        if (t < best) {
+            best = t;
+            profile.threads = threads == hardware ? 0 : threads;
+        }
+    }
+
+    // 并行阈值：取并行开始快于串行的最小问题规模（至少两个行块才会并行）
+    ApplyTuneProfile(profile);
+    profile.parallel_min_flops = 2 * n * n * n;
+    for (size_t size = 2 * profile.gemm.block_m; size <= n; size *= 2) {
+        const auto sa = RandomMatrix(size, 3), sb = RandomMatrix(size, 4);
+        vector<double> sc(size * size);
+        const double serial = TimeGemm(size, sa, sb, sc, profile.gemm, nullptr);
+        const double parallel = TimeGemm(size, sa, sb, sc, profile.gemm, &pool);
+        cout << "size " << size << ": serial " << serial * 1e3 << " ms, parallel " << parallel * 1e3 << " ms\n";
+        if (parallel < serial) {
+            profile.parallel_min_flops = 2 * size * size * size;
+            break;
+        }
+    }
+
+    SaveTuneProfile(output, profile);
+    cout << "profile written to " << output << '\n';
+    WriteTuneProfile(cout, profile);
+    return 0;
+}
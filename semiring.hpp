@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "mat.hpp"
+#include "gemm.hpp"
+#include "pool.hpp"
+
+#ifndef SEMIRING_HPP
+#define SEMIRING_HPP
+
+// 半环策略：Zero 为加法单位元（且为乘法零元），One 为乘法单位元
+
+// 普通 (+, *)
+template <typename T>
+struct PlusTimes final
+{
+    using value_type = T;
+
+    static constexpr T Zero() { return T(0); }
+
+    static constexpr T One() { return T(1); }
+
+    static constexpr T Add(T a, T b) { return a + b; }
+
+    static constexpr T Mul(T a, T b) { return a * b; }
+};
+
+namespace Detail
+{
+    // 热带半环的无穷元：浮点用 infinity，整数用极值
+    template <typename T>
+    constexpr T TropicalInfinity(bool positive)
+    {
+        if constexpr (std::numeric_limits<T>::has_infinity)
+            return positive ? std::numeric_limits<T>::infinity() : -std::numeric_limits<T>::infinity();
+        else
+            return positive ? std::numeric_limits<T>::max() : std::numeric_limits<T>::lowest();
+    }
+}
+
+// (min, +)：最短路径；整数无穷元参与加法时保持为无穷，不会溢出
+template <typename T>
+struct MinPlus final
+{
+    using value_type = T;
+
+    static constexpr T Zero() { return Detail::TropicalInfinity<T>(true); }
+
+    static constexpr T One() { return T(0); }
+
+    static constexpr T Add(T a, T b) { return std::min(a, b); }
+
+    static constexpr T Mul(T a, T b)
+    {
+        if constexpr (std::numeric_limits<T>::has_infinity)
+            return a + b;
+        else
+            return (a == Zero() || b == Zero()) ? Zero() : a + b;
+    }
+};
+
+// (max, +)：最长路径 / 关键路径
+template <typename T>
+struct MaxPlus final
+{
+    using value_type = T;
+
+    static constexpr T Zero() { return Detail::TropicalInfinity<T>(false); }
+
+    static constexpr T One() { return T(0); }
+
+    static constexpr T Add(T a, T b) { return std::max(a, b); }
+
+    static constexpr T Mul(T a, T b)
+    {
+        if constexpr (std::numeric_limits<T>::has_infinity)
+            return a + b;
+        else
+            return (a == Zero() || b == Zero()) ? Zero() : a + b;
+    }
+};
+
+// (or, and)：可达性
+struct OrAnd final
+{
+    using value_type = bool;
+
+    static constexpr bool Zero() { return false; }
+
+    static constexpr bool One() { return true; }
+
+    static constexpr bool Add(bool a, bool b) { return a || b; }
+
+    static constexpr bool Mul(bool a, bool b) { return a && b; }
+};
+
+namespace Detail
+{
+    // 概念：Semiring 表示半环策略
+    template <typename S>
+    concept Semiring = requires(typename S::value_type a) {
+        { S::Zero() } -> std::convertible_to<typename S::value_type>;
+        { S::One() } -> std::convertible_to<typename S::value_type>;
+        { S::Add(a, a) } -> std::convertible_to<typename S::value_type>;
+        { S::Mul(a, a) } -> std::convertible_to<typename S::value_type>;
+    };
+
+    template <Semiring S>
+    struct SemiringAccumulate
+    {
+        using T = typename S::value_type;
+
+        constexpr T operator()(T a, T b, T c) const { return S::Add(c, S::Mul(a, b)); }
+    };
+}
+
+// 半环矩阵乘法：C[i, j] = Add_k Mul(A[i, k], B[k, j])
+template <Detail::Semiring S, size_t Row, size_t Col, size_t OtherCol>
+constexpr Mat<typename S::value_type, Row, OtherCol> Multiply(S, const Mat<typename S::value_type, Row, Col> &lhs,
+                                                              const Mat<typename S::value_type, Col, OtherCol> &rhs)
+{
+    using T = typename S::value_type;
+    Mat<T, Row, OtherCol> result(S::Zero());
+    // 与 Gemm 内核相同的 i-k-j 顺序
+    for (size_t i = 0; i < Row; ++i)
+    {
+        for (size_t k = 0; k < Col; ++k)
+        {
+            const T a = lhs[i, k];
+            for (size_t j = 0; j < OtherCol; ++j)
+                result[i, j] = S::Add(result[i, j], S::Mul(a, rhs[k, j]));
+        }
+    }
+    return result;
+}
+
+// 半环单位矩阵：对角线为 One，其余为 Zero
+template <Detail::Semiring S, size_t Size>
+constexpr Mat<typename S::value_type, Size, Size> MakeIdentity(S)
+{
+    Mat<typename S::value_type, Size, Size> result(S::Zero());
+    for (size_t i = 0; i < Size; ++i)
+        result[i, i] = S::One();
+    return result;
+}
+
+// 半环矩阵幂（反复平方）。MinPlus 下 MatPow(S, w, n - 1) 即为全源最短路径长度
+template <Detail::Semiring S, size_t Size>
+constexpr Mat<typename S::value_type, Size, Size> MatPow(S semiring, Mat<typename S::value_type, Size, Size> base,
+                                                         std::uint64_t exponent)
+{
+    auto result = MakeIdentity<S, Size>(semiring);
+    while (exponent)
+    {
+        if (exponent & 1)
+            result = Multiply(semiring, result, base);
+        exponent >>= 1;
+        if (exponent)
+            base = Multiply(semiring, base, base);
+    }
+    return result;
+}
+
+// 分块半环乘法（运行期尺寸）：C = C (+) A (x) B，复用 Gemm 的分块与并行结构；
+// C 须预先填充 S::Zero() 或已有的累加值
+template <Detail::Semiring S>
+void SemiringGemm(S, std::type_identity_t<MatrixView<const typename S::value_type>> a,
+                  std::type_identity_t<MatrixView<const typename S::value_type>> b,
+                  MatrixView<typename S::value_type> c, const GemmConfig &config = ActiveTuneProfile().gemm)
+{
+    Detail::CheckGemmShape(a.rows, a.cols, b.rows, b.cols, c.rows, c.cols);
+    Detail::GemmBlocked<typename S::value_type>(a, b, c, Detail::CheckedConfig(config), Detail::SemiringAccumulate<S>{});
+}
+
+template <Detail::Semiring S>
+void SemiringGemm(S, std::type_identity_t<MatrixView<const typename S::value_type>> a,
+                  std::type_identity_t<MatrixView<const typename S::value_type>> b,
+                  MatrixView<typename S::value_type> c, ThreadPool &pool,
+                  const GemmConfig &config = ActiveTuneProfile().gemm)
+{
+    Detail::CheckGemmShape(a.rows, a.cols, b.rows, b.cols, c.rows, c.cols);
+    Detail::GemmBlocked<typename S::value_type>(a, b, c, Detail::CheckedConfig(config), Detail::SemiringAccumulate<S>{}, pool);
+}
+
+#endif // SEMIRING_HPP
@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include "vec.hpp"
+#include "mat.hpp"
+#include "pool.hpp"
+
+#ifndef SKIN_HPP
+#define SKIN_HPP
+
+// 顶点位置的 SoA 视图：T 为 const float 等只读类型时用作输入
+template <typename T>
+struct PositionSoA final
+{
+    std::span<T> x, y, z;
+
+    std::size_t size() const noexcept { return x.size(); }
+};
+
+// 对偶四元数：real 为旋转 (x, y, z, w)，dual 编码平移
+template <std::floating_point T>
+struct DualQuat final
+{
+    Vec<T, 4> real;
+    Vec<T, 4> dual;
+};
+
+namespace Detail
+{
+    // 每个并行块处理的顶点数
+    inline constexpr std::size_t SkinChunk = 1024;
+
+    template <typename T>
+    void CheckSkinInput(std::size_t bones, const PositionSoA<const T> &in, std::size_t indices, std::size_t weights, const PositionSoA<T> &out)
+    {
+        const std::size_t n = in.size();
+        if (in.y.size() != n || in.z.size() != n || indices != n || weights != n ||
+            out.size() != n || out.y.size() != n || out.z.size() != n)
+        {
+            throw std::runtime_error("SkinVertices span size mismatch");
+        }
+        if (bones == 0)
+        {
+            throw std::runtime_error("SkinVertices requires at least one bone");
+        }
+    }
+
+    // 线性混合蒙皮：先按权重混合 3x4 骨骼矩阵，再对顶点做一次仿射变换
+    template <std::floating_point T, std::integral I>
+    void SkinRange(std::span<const Mat<T, 3, 4>> bones, const PositionSoA<const T> &in,
+                   std::span<const Vec<I, 4>> indices, std::span<const Vec<T, 4>> weights,
+                   const PositionSoA<T> &out, std::size_t first, std::size_t last)
+    {
+        for (std::size_t v = first; v < last; ++v)
+        {
+            T m[12] = {};
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                const T w = weights[v][k];
+                if (w == 0)
+                    continue;
+                const auto &b = bones[static_cast<std::size_t>(indices[v][k])];
+                for (std::size_t e = 0; e < 12; ++e)
+                    m[e] += w * b[e];
+            }
+            const T px = in.x[v], py = in.y[v], pz = in.z[v];
+            out.x[v] = m[0] * px + m[1] * py + m[2] * pz + m[3];
+            out.y[v] = m[4] * px + m[5] * py + m[6] * pz + m[7];
+            out.z[v] = m[8] * px + m[9] * py + m[10] * pz + m[11];
+        }
+    }
+
+    // 对偶四元数蒙皮：按权重混合（处理对跖符号）、归一化后变换顶点
+    template <std::floating_point T, std::integral I>
+    void SkinRangeDualQuat(std::span<const DualQuat<T>> bones, const PositionSoA<const T> &in,
+                           std::span<const Vec<I, 4>> indices, std::span<const Vec<T, 4>> weights,
+                           const PositionSoA<T> &out, std::size_t first, std::size_t last)
+    {
+        for (std::size_t v = first; v < last; ++v)
+        {
+            T r[4] = {}, d[4] = {};
+            const auto &pivot = bones[static_cast<std::size_t>(indices[v][0])].real;
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                T w = weights[v][k];
+                if (w == 0)
+                    continue;
+                const auto &b = bones[static_cast<std::size_t>(indices[v][k])];
+                if (b.real[0] * pivot[0] + b.real[1] * pivot[1] + b.real[2] * pivot[2] + b.real[3] * pivot[3] < 0)
+                    w = -w;
+                for (std::size_t e = 0; e < 4; ++e)
+                {
+                    r[e] += w * b.real[e];
+                    d[e] += w * b.dual[e];
+                }
+            }
+
+            using std::sqrt;
+            const T inv = T(1) / sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2] + r[3] * r[3]);
+            for (std::size_t e = 0; e < 4; ++e)
+            {
+                r[e] *= inv;
+                d[e] *= inv;
+            }
+
+            // 旋转：p' = p + 2 * rv x (rv x p + w * p)
+            const T px = in.x[v], py = in.y[v], pz = in.z[v];
+            const T cx = r[1] * pz - r[2] * py + r[3] * px;
+            const T cy = r[2] * px - r[0] * pz + r[3] * py;
+            const T cz = r[0] * py - r[1] * px + r[3] * pz;
+            T qx = px + T(2) * (r[1] * cz - r[2] * cy);
+            T qy = py + T(2) * (r[2] * cx - r[0] * cz);
+            T qz = pz + T(2) * (r[0] * cy - r[1] * cx);
+
+            // 平移：t = 2 * (rw * dv - dw * rv + rv x dv)
+            qx += T(2) * (r[3] * d[0] - d[3] * r[0] + r[1] * d[2] - r[2] * d[1]);
+            qy += T(2) * (r[3] * d[1] - d[3] * r[1] + r[2] * d[0] - r[0] * d[2]);
+            qz += T(2) * (r[3] * d[2] - d[3] * r[2] + r[0] * d[1] - r[1] * d[0]);
+
+            out.x[v] = qx;
+            out.y[v] = qy;
+            out.z[v] = qz;
+        }
+    }
+}
+
+// 由 3x4 刚体变换（旋转部分须正交）构造对偶四元数
+template <std::floating_point T>
+DualQuat<T> MakeDualQuat(const Mat<T, 3, 4> &m)
+{
+    using std::sqrt;
+    Vec<T, 4> q;
+    const T trace = m[0, 0] + m[1, 1] + m[2, 2];
+    if (trace > 0)
+    {
+        const T s = sqrt(trace + T(1)) * T(2);
+        q = Vec<T, 4>((m[2, 1] - m[1, 2]) / s, (m[0, 2] - m[2, 0]) / s, (m[1, 0] - m[0, 1]) / s, s / T(4));
+    }
+    else if (m[0, 0] > m[1, 1] && m[0, 0] > m[2, 2])
+    {
+        const T s = sqrt(T(1) + m[0, 0] - m[1, 1] - m[2, 2]) * T(2);
+        q = Vec<T, 4>(s / T(4), (m[0, 1] + m[1, 0]) / s, (m[0, 2] + m[2, 0]) / s, (m[2, 1] - m[1, 2]) / s);
+    }
+    else if (m[1, 1] > m[2, 2])
+    {
+        const T s = sqrt(T(1) + m[1, 1] - m[0, 0] - m[2, 2]) * T(2);
+        q = Vec<T, 4>((m[0, 1] + m[1, 0]) / s, s / T(4), (m[1, 2] + m[2, 1]) / s, (m[0, 2] - m[2, 0]) / s);
+    }
+    else
+    {
+        const T s = sqrt(T(1) + m[2, 2] - m[0, 0] - m[1, 1]) * T(2);
+        q = Vec<T, 4>((m[0, 2] + m[2, 0]) / s, (m[1, 2] + m[2, 1]) / s, s / T(4), (m[1, 0] - m[0, 1]) / s);
+    }
+
+    // dual = 0.5 * (0, t) * q
+    const T tx = m[0, 3], ty = m[1, 3], tz = m[2, 3];
+    const Vec<T, 4> d(
+        T(0.5) * (q[3] * tx + ty * q[2] - tz * q[1]),
+        T(0.5) * (q[3] * ty + tz * q[0] - tx * q[2]),
+        T(0.5) * (q[3] * tz + tx * q[1] - ty * q[0]),
+        T(-0.5) * (tx * q[0] + ty * q[1] + tz * q[2]));
+    return DualQuat<T>{q, d};
+}
+
+// 线性混合蒙皮：每个顶点至多 4 根骨骼，权重之和应为 1
+template <std::floating_point T, std::integral I>
+void SkinVertices(std::span<const Mat<T, 3, 4>> bones, const PositionSoA<const T> &in,
+                  std::span<const Vec<I, 4>> indices, std::span<const Vec<T, 4>> weights, const PositionSoA<T> &out)
+{
+    Detail::CheckSkinInput(bones.size(), in, indices.size(), weights.size(), out);
+    Detail::SkinRange(bones, in, indices, weights, out, 0, in.size());
+}
+
+// 线性混合蒙皮（按顶点块并行）
+template <std::floating_point T, std::integral I>
+void SkinVertices(std::span<const Mat<T, 3, 4>> bones, const PositionSoA<const T> &in,
+                  std::span<const Vec<I, 4>> indices, std::span<const Vec<T, 4>> weights, const PositionSoA<T> &out,
+                  ThreadPool &pool)
+{
+    Detail::CheckSkinInput(bones.size(), in, indices.size(), weights.size(), out);
+    const std::size_t n = in.size();
+    const std::size_t chunks = (n + Detail::SkinChunk - 1) / Detail::SkinChunk;
+    ParallelFor(pool, 0, chunks, 1, [&](std::size_t c)
+                { Detail::SkinRange(bones, in, indices, weights, out, c * Detail::SkinChunk, std::min(n, (c + 1) * Detail::SkinChunk)); });
+}
+
+// 对偶四元数蒙皮：避免线性混合在大角度扭转时的体积塌缩
+template <std::floating_point T, std::integral I>
+void SkinVertices(std::span<const DualQuat<T>> bones, const PositionSoA<const T> &in,
+                  std::span<const Vec<I, 4>> indices, std::span<const Vec<T, 4>> weights, const PositionSoA<T> &out)
+{
+    Detail::CheckSkinInput(bones.size(), in, indices.size(), weights.size(), out);
+    Detail::SkinRangeDualQuat(bones, in, indices, weights, out, 0, in.size());
+}
+
+// 对偶四元数蒙皮（按顶点块并行）
+template <std::floating_point T, std::integral I>
+void SkinVertices(std::span<const DualQuat<T>> bones, const PositionSoA<const T> &in,
+                  std::span<const Vec<I, 4>> indices, std::span<const Vec<T, 4>> weights, const PositionSoA<T> &out,
+                  ThreadPool &pool)
+{
+    Detail::CheckSkinInput(bones.size(), in, indices.size(), weights.size(), out);
+    const std::size_t n = in.size();
+    const std::size_t chunks = (n + Detail::SkinChunk - 1) / Detail::SkinChunk;
+    ParallelFor(pool, 0, chunks, 1, [&](std::size_t c)
+                { Detail::SkinRangeDualQuat(bones, in, indices, weights, out, c * Detail::SkinChunk, std::min(n, (c + 1) * Detail::SkinChunk)); });
+}
+
+#endif // SKIN_HPP
@@ -0,0 +1,302 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define RMATH_HAS_RDTSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define RMATH_HAS_RDTSC 1
+#endif
+
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+// 追踪事件：name 须为静态存储期字符串（通常为字面量），TraceEvents 返回的时间单位为纳秒
+struct TraceEvent final
+{
+    const char *name = nullptr;
+    std::uint64_t start = 0;
+    std::uint64_t duration = 0;
+    std::uint32_t thread = 0;
+};
+
+namespace Detail
+{
+    // 默认每线程 4096 个事件（128 KiB），可用 SetTraceCapacity 调整
+    inline constexpr std::size_t DefaultTraceCapacity = std::size_t(1) << 12;
+
+    // 每线程环形缓冲：只有所属线程写入，写满后覆盖最旧的事件，记录一次不加锁、不分配
+    struct TraceBuffer
+    {
+        // 容量为 2 的幂
+        std::size_t capacity;
+        std::unique_ptr<TraceEvent[]> events;
+        std::atomic<std::uint64_t> head = 0;
+        std::uint32_t thread = 0;
+        // 所属线程已退出，下次 ClearTrace 时释放
+        std::atomic<bool> exited = false;
+
+        explicit TraceBuffer(std::size_t events_capacity)
+            : capacity(events_capacity), events(std::make_unique<TraceEvent[]>(events_capacity))
+        {
+        }
+
+        void Push(const char *name, std::uint64_t start, std::uint64_t duration)
+        {
+            const std::uint64_t index = head.load(std::memory_order_relaxed);
+            events[index & (capacity - 1)] = TraceEvent{name, start, duration, thread};
+            head.store(index + 1, std::memory_order_release);
+        }
+    };
+
+    // 全局登记表：线程退出后其缓冲仍由登记表持有，以便导出其事件；下次 ClearTrace 时释放
+    struct TraceRegistry
+    {
+        std::mutex mutex;
+        std::vector<std::shared_ptr<TraceBuffer>> buffers;
+        std::uint32_t next_thread = 1;
+        std::size_t capacity = DefaultTraceCapacity;
+
+        static TraceRegistry &Instance()
+        {
+            static TraceRegistry registry;
+            return registry;
+        }
+    };
+
+    inline std::uint64_t SteadyNanoseconds()
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+    // 记录时使用的时间戳：x86 上直接读 TSC（比 steady_clock 便宜得多），导出时再换算为纳秒
+    inline std::uint64_t TraceNow()
+    {
+#if defined(RMATH_HAS_RDTSC)
+        return __rdtsc();
+#else
+        return SteadyNanoseconds();
+#endif
+    }
+
+    // 时间戳换算：以首次使用时的 (TraceNow, steady_clock) 为基准，导出时按两点斜率换算
+    struct TraceClock
+    {
+        std::uint64_t ticks0 = TraceNow();
+        std::uint64_t nanoseconds0 = SteadyNanoseconds();
+
+        static TraceClock &Instance()
+        {
+            static TraceClock clock;
+            return clock;
+        }
+
+        double NanosecondsPerTick() const
+        {
+#if defined(RMATH_HAS_RDTSC)
+            // 与基准点相距不足 1 ms 时等待，保证斜率精度
+            std::uint64_t nanoseconds = SteadyNanoseconds();
+            while (nanoseconds - nanoseconds0 < 1000000)
+                nanoseconds = SteadyNanoseconds();
+            const std::uint64_t ticks = TraceNow();
+            return static_cast<double>(nanoseconds - nanoseconds0) / static_cast<double>(ticks - ticks0);
+#else
+            return 1.0;
+#endif
+        }
+
+        std::uint64_t ToNanoseconds(std::uint64_t ticks, double scale) const
+        {
+            const double delta = static_cast<double>(static_cast<std::int64_t>(ticks - ticks0)) * scale;
+            return nanoseconds0 + static_cast<std::uint64_t>(static_cast<std::int64_t>(delta));
+        }
+    };
+
+    // 本线程缓冲的缓存指针：常量初始化的 thread_local 没有初始化守卫，热路径只是一次 TLS 读取；
+    // 缓冲的所有权在登记表中
+    inline thread_local TraceBuffer *CachedTraceBuffer = nullptr;
+    inline thread_local bool TraceThreadExiting = false;
+
+    // 线程退出时标记缓冲；之后（其他 thread_local 析构期间）的事件直接丢弃
+    struct TraceThreadExit
+    {
+        std::shared_ptr<TraceBuffer> buffer;
+
+        ~TraceThreadExit()
+        {
+            CachedTraceBuffer = nullptr;
+            TraceThreadExiting = true;
+            buffer->exited.store(true, std::memory_order_release);
+        }
+    };
+
+    // 首次使用：创建缓冲并登记；线程正在退出时返回 nullptr
+    inline TraceBuffer *CreateLocalTraceBuffer()
+    {
+        if (TraceThreadExiting)
+            return nullptr;
+        TraceClock::Instance();
+        auto &registry = TraceRegistry::Instance();
+        std::shared_ptr<TraceBuffer> created;
+        {
+            std::lock_guard lock(registry.mutex);
+            created = std::make_shared<TraceBuffer>(registry.capacity);
+            created->thread = registry.next_thread++;
+            registry.buffers.push_back(created);
+        }
+        thread_local TraceThreadExit exit{created};
+        CachedTraceBuffer = created.get();
+        return created.get();
+    }
+
+    inline TraceBuffer *LocalTraceBuffer()
+    {
+        if (TraceBuffer *buffer = CachedTraceBuffer) [[likely]]
+            return buffer;
+        return CreateLocalTraceBuffer();
+    }
+
+    inline void WriteJsonString(std::ostream &os, const char *text)
+    {
+        os << '"';
+        for (; *text; ++text)
+        {
+            if (*text == '"' || *text == '\\')
+                os << '\\';
+            if (static_cast<unsigned char>(*text) >= 0x20)
+                os << *text;
+        }
+        os << '"';
+    }
+}
+
+// 作用域事件：构造时记下开始时间，析构时写入本线程的环形缓冲；常量求值期间不做任何事，
+// 因此可以放在 constexpr 函数中
+struct TraceScope final
+{
+private:
+    // 数据
+    const char *_name;
+    std::uint64_t _start = 0;
+
+public:
+    // 构造
+    constexpr explicit TraceScope(const char *name) : _name(name)
+    {
+        if !consteval
+        {
+            _start = Detail::TraceNow();
+        }
+    }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+
+    constexpr ~TraceScope()
+    {
+        if !consteval
+        {
+            if (auto *buffer = Detail::LocalTraceBuffer())
+                buffer->Push(_name, _start, Detail::TraceNow() - _start);
+        }
+    }
+};
+
+// 收集所有线程缓冲中的事件，按开始时间排序。应在被追踪的线程空闲时调用
+inline std::vector<TraceEvent> TraceEvents()
+{
+    auto &registry = Detail::TraceRegistry::Instance();
+    const auto &clock = Detail::TraceClock::Instance();
+    const double scale = clock.NanosecondsPerTick();
+    std::lock_guard lock(registry.mutex);
+    std::vector<TraceEvent> events;
+    for (const auto &buffer : registry.buffers)
+    {
+        const std::uint64_t head = buffer->head.load(std::memory_order_acquire);
+        const std::uint64_t count = std::min<std::uint64_t>(head, buffer->capacity);
+        for (std::uint64_t i = head - count; i < head; ++i)
+        {
+            TraceEvent event = buffer->events[i & (buffer->capacity - 1)];
+            event.start = clock.ToNanoseconds(event.start, scale);
+            event.duration = static_cast<std::uint64_t>(static_cast<double>(event.duration) * scale);
+            events.push_back(event);
+        }
+    }
+    std::sort(events.begin(), events.end(), [](const TraceEvent &a, const TraceEvent &b)
+              { return a.start < b.start; });
+    return events;
+}
+
+// 清空所有缓冲，并释放所属线程已退出的缓冲
+inline void ClearTrace()
+{
+    auto &registry = Detail::TraceRegistry::Instance();
+    std::lock_guard lock(registry.mutex);
+    std::erase_if(registry.buffers, [](const auto &buffer)
+                  { return buffer->exited.load(std::memory_order_acquire); });
+    for (const auto &buffer : registry.buffers)
+        buffer->head.store(0, std::memory_order_release);
+}
+
+// 每线程缓冲可保存的事件数（向上取到 2 的幂，至少 16），只影响之后新建的缓冲
+inline void SetTraceCapacity(std::size_t events)
+{
+    auto &registry = Detail::TraceRegistry::Instance();
+    std::lock_guard lock(registry.mutex);
+    registry.capacity = std::bit_ceil(std::max<std::size_t>(events, 16));
+}
+
+// 输出 Chrome trace JSON（chrome://tracing、Perfetto 可直接打开），时间以微秒表示
+inline void WriteChromeTrace(std::ostream &os)
+{
+    const auto events = TraceEvents();
+    const std::uint64_t origin = events.empty() ? 0 : events.front().start;
+    os << "{\"traceEvents\":[";
+    for (std::size_t i = 0; i < events.size(); ++i)
+    {
+        const auto &event = events[i];
+        os << (i ? ",\n" : "\n") << "{\"name\":";
+        Detail::WriteJsonString(os, event.name);
+        os << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+           << ",\"ts\":" << static_cast<double>(event.start - origin) / 1000.0
+           << ",\"dur\":" << static_cast<double>(event.duration) / 1000.0 << '}';
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+inline void WriteChromeTrace(const std::string &path)
+{
+    std::ofstream out(path);
+    if (!out)
+    {
+        throw std::runtime_error("Cannot write trace file: " + path);
+    }
+    WriteChromeTrace(out);
+}
+
+// 编译期开关：定义 RMATH_TRACE 时库内的重运算（Det、Inverse、Rank、矩阵乘法、ParallelFor 分块）记录事件，
+// 否则宏展开为空，没有任何开销
+#define RMATH_TRACE_CONCAT_IMPL(a, b) a##b
+#define RMATH_TRACE_CONCAT(a, b) RMATH_TRACE_CONCAT_IMPL(a, b)
+
+#if defined(RMATH_TRACE)
+#define RMATH_TRACE_SCOPE(name) const TraceScope RMATH_TRACE_CONCAT(rmath_trace_scope_, __LINE__)(name)
+#else
+#define RMATH_TRACE_SCOPE(name) ((void)0)
+#endif
+
+#endif // TRACE_HPP
@@ -0,0 +1,185 @@
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include "vec.hpp"
+#include "mat.hpp"
+
+#ifndef TRANSFORM_HPP
+#define TRANSFORM_HPP
+
+// 约定：列向量（clip = M * p），右手坐标系，裁剪空间深度范围 [-1, 1]
+
+namespace Detail
+{
+    // 编译期可用的平方根与正切，运行期直接调用标准库
+    template <std::floating_point T>
+    constexpr T ConstexprSqrt(T x)
+    {
+        if consteval
+        {
+            if (!(x > 0))
+                return T(0);
+            T r = x > 1 ? x : T(1);
+            for (int i = 0; i < 128; ++i)
+            {
+                T next = (r + x / r) / 2;
+                if (next >= r)
+                    break;
+                r = next;
+            }
+            return r;
+        }
+        else
+        {
+            return std::sqrt(x);
+        }
+    }
+
+    template <std::floating_point T>
+    constexpr T ConstexprTan(T x)
+    {
+        if consteval
+        {
+            // 仅用于 (-pi/2, pi/2) 内的视场角
+            T x2 = x * x, term = x, s = x;
+            for (int k = 1; k < 30; ++k)
+            {
+                term *= -x2 / static_cast<T>((2 * k) * (2 * k + 1));
+                s += term;
+            }
+            term = 1;
+            T c = 1;
+            for (int k = 1; k < 30; ++k)
+            {
+                term *= -x2 / static_cast<T>((2 * k - 1) * (2 * k));
+                c += term;
+            }
+            return s / c;
+        }
+        else
+        {
+            return std::tan(x);
+        }
+    }
+
+    template <std::floating_point T>
+    constexpr Vec<T, 3> ConstexprNormalize(const Vec<T, 3> &v)
+    {
+        const T len = ConstexprSqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        return len > 0 ? Vec<T, 3>(v[0] / len, v[1] / len, v[2] / len) : Vec<T, 3>{};
+    }
+}
+
+// 透视投影：fovy 为竖直视场角（弧度）
+template <std::floating_point T>
+constexpr Mat<T, 4, 4> Perspective(T fovy, T aspect, T z_near, T z_far)
+{
+    const T f = T(1) / Detail::ConstexprTan(fovy / 2);
+    Mat<T, 4, 4> result;
+    result[0, 0] = f / aspect;
+    result[1, 1] = f;
+    result[2, 2] = (z_far + z_near) / (z_near - z_far);
+    result[2, 3] = T(2) * z_far * z_near / (z_near - z_far);
+    result[3, 2] = T(-1);
+    return result;
+}
+
+// 正交投影
+template <std::floating_point T>
+constexpr Mat<T, 4, 4> Orthographic(T left, T right, T bottom, T top, T z_near, T z_far)
+{
+    Mat<T, 4, 4> result;
+    result[0, 0] = T(2) / (right - left);
+    result[1, 1] = T(2) / (top - bottom);
+    result[2, 2] = T(-2) / (z_far - z_near);
+    result[0, 3] = -(right + left) / (right - left);
+    result[1, 3] = -(top + bottom) / (top - bottom);
+    result[2, 3] = -(z_far + z_near) / (z_far - z_near);
+    result[3, 3] = T(1);
+    return result;
+}
+
+// 观察矩阵：相机位于 eye，看向 center
+template <std::floating_point T>
+constexpr Mat<T, 4, 4> LookAt(const Vec<T, 3> &eye, const Vec<T, 3> &center, const Vec<T, 3> &up)
+{
+    const Vec<T, 3> f = Detail::ConstexprNormalize(center - eye);
+    const Vec<T, 3> s = Detail::ConstexprNormalize(f ^ up);
+    const Vec<T, 3> u = s ^ f;
+
+    Mat<T, 4, 4> result;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        result[0, i] = s[i];
+        result[1, i] = u[i];
+        result[2, i] = -f[i];
+    }
+    result[0, 3] = -(s[0] * eye[0] + s[1] * eye[1] + s[2] * eye[2]);
+    result[1, 3] = -(u[0] * eye[0] + u[1] * eye[1] + u[2] * eye[2]);
+    result[2, 3] = f[0] * eye[0] + f[1] * eye[1] + f[2] * eye[2];
+    result[3, 3] = T(1);
+    return result;
+}
+
+// 仿射矩阵乘法：假定 a、b 的最后一行均为 (0, 0, 0, 1)，只计算上方 3x4 块
+template <Detail::NumericMat T>
+constexpr Mat<T, 4, 4> AffineMultiply(const Mat<T, 4, 4> &a, const Mat<T, 4, 4> &b)
+{
+    Mat<T, 4, 4> result;
+    for (std::size_t r = 0; r < 3; ++r)
+    {
+        const T a0 = a[r, 0], a1 = a[r, 1], a2 = a[r, 2];
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+            result[r, c] = a0 * b[0, c] + a1 * b[1, c] + a2 * b[2, c];
+        }
+        result[r, 3] += a[r, 3];
+    }
+    result[3, 3] = T(1);
+    return result;
+}
+
+// 批量投影到屏幕：矩阵乘法、透视除法与视口变换融合在一次遍历中
+// viewport 为 (x, y, width, height)，输出窗口坐标 y 轴向上；
+// visible 非空时写入裁剪掩码（1 表示在视锥内，0 表示被裁剪）
+template <std::floating_point T>
+void ProjectPoints(const Mat<T, 4, 4> &m, std::span<const Vec<T, 3>> points, std::span<Vec<T, 2>> out,
+                   const Vec<T, 4> &viewport, std::span<std::uint8_t> visible = {})
+{
+    if (out.size() != points.size() || (!visible.empty() && visible.size() != points.size()))
+    {
+        throw std::runtime_error("ProjectPoints span size mismatch");
+    }
+
+    // 矩阵元素提到循环外，循环体只剩标量乘加
+    const T m00 = m[0, 0], m01 = m[0, 1], m02 = m[0, 2], m03 = m[0, 3];
+    const T m10 = m[1, 0], m11 = m[1, 1], m12 = m[1, 2], m13 = m[1, 3];
+    const T m20 = m[2, 0], m21 = m[2, 1], m22 = m[2, 2], m23 = m[2, 3];
+    const T m30 = m[3, 0], m31 = m[3, 1], m32 = m[3, 2], m33 = m[3, 3];
+    const T half_w = viewport[2] / 2, half_h = viewport[3] / 2;
+    const T center_x = viewport[0] + half_w, center_y = viewport[1] + half_h;
+
+    const std::size_t n = points.size();
+    const bool cull = !visible.empty();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const T x = points[i][0], y = points[i][1], z = points[i][2];
+        const T cx = m00 * x + m01 * y + m02 * z + m03;
+        const T cy = m10 * x + m11 * y + m12 * z + m13;
+        const T cw = m30 * x + m31 * y + m32 * z + m33;
+        const T inv = T(1) / cw;
+        out[i][0] = center_x + cx * inv * half_w;
+        out[i][1] = center_y + cy * inv * half_h;
+
+        if (cull)
+        {
+            const T cz = m20 * x + m21 * y + m22 * z + m23;
+            visible[i] = static_cast<std::uint8_t>(cw > 0 && -cw <= cx && cx <= cw && -cw <= cy && cy <= cw && -cw <= cz && cz <= cw);
+        }
+    }
+}
+
+#endif // TRANSFORM_HPP
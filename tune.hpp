@@ -0,0 +1,164 @@
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#ifndef TUNE_HPP
+#define TUNE_HPP
+
+// 分块参数：block_m x block_k 的 A 块与 block_k x block_n 的 B 块应能同时留在缓存中
+struct GemmConfig final
+{
+    std::size_t block_m = 64;
+    std::size_t block_n = 256;
+    std::size_t block_k = 256;
+};
+
+// 调优配置：由 rmath_tune 在目标机器上测得，运行期通过 LoadTuneProfile 或环境变量 RMATH_TUNE_PROFILE 载入
+struct TuneProfile final
+{
+    GemmConfig gemm{};
+
+    // 分块转置的块边长
+    std::size_t transpose_block = 32;
+
+    // 低于该浮点运算量（2 * m * n * k）时并行版 Gemm 退化为串行
+    std::size_t parallel_min_flops = std::size_t(1) << 21;
+
+    // 并行 Gemm 使用的线程数上限（0 表示使用线程池的全部线程）
+    std::size_t threads = 0;
+};
+
+namespace Detail
+{
+    struct TuneState
+    {
+        std::mutex mutex;
+        TuneProfile profile;
+        bool loaded = false;
+
+        static TuneState &Instance()
+        {
+            static TuneState state;
+            return state;
+        }
+    };
+
+    inline std::size_t ParseTuneValue(const std::string &key, const std::string &value)
+    {
+        std::size_t used = 0;
+        unsigned long long parsed = 0;
+        try
+        {
+            parsed = std::stoull(value, &used);
+        }
+        catch (const std::exception &)
+        {
+            used = 0;
+        }
+        if (used == 0 || used != value.size())
+        {
+            throw std::runtime_error("Invalid value for tune key " + key + ": " + value);
+        }
+        return static_cast<std::size_t>(parsed);
+    }
+}
+
+// 解析配置文本：每行 "key = value"，# 开头为注释，未知键忽略以便新旧版本互相读取
+inline TuneProfile ParseTuneProfile(std::istream &in)
+{
+    TuneProfile profile;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        const auto hash = line.find('#');
+        if (hash != std::string::npos)
+            line.erase(hash);
+        const auto eq = line.find('=');
+        if (eq == std::string::npos)
+        {
+            if (line.find_first_not_of(" \t\r") != std::string::npos)
+            {
+                throw std::runtime_error("Malformed tune profile line: " + line);
+            }
+            continue;
+        }
+        std::istringstream key_stream(line.substr(0, eq)), value_stream(line.substr(eq + 1));
+        std::string key, value;
+        key_stream >> key;
+        value_stream >> value;
+        if (key == "gemm.block_m")
+            profile.gemm.block_m = Detail::ParseTuneValue(key, value);
+        else if (key == "gemm.block_n")
+            profile.gemm.block_n = Detail::ParseTuneValue(key, value);
+        else if (key == "gemm.block_k")
+            profile.gemm.block_k = Detail::ParseTuneValue(key, value);
+        else if (key == "transpose_block")
+            profile.transpose_block = Detail::ParseTuneValue(key, value);
+        else if (key == "parallel_min_flops")
+            profile.parallel_min_flops = Detail::ParseTuneValue(key, value);
+        else if (key == "threads")
+            profile.threads = Detail::ParseTuneValue(key, value);
+    }
+    return profile;
+}
+
+inline void WriteTuneProfile(std::ostream &out, const TuneProfile &profile)
+{
+    out << "gemm.block_m = " << profile.gemm.block_m << '\n'
+        << "gemm.block_n = " << profile.gemm.block_n << '\n'
+        << "gemm.block_k = " << profile.gemm.block_k << '\n'
+        << "transpose_block = " << profile.transpose_block << '\n'
+        << "parallel_min_flops = " << profile.parallel_min_flops << '\n'
+        << "threads = " << profile.threads << '\n';
+}
+
+// 读写配置文件
+inline TuneProfile LoadTuneProfile(const std::string &path)
+{
+    std::ifstream in(path);
+    if (!in)
+    {
+        throw std::runtime_error("Cannot open tune profile: " + path);
+    }
+    return ParseTuneProfile(in);
+}
+
+inline void SaveTuneProfile(const std::string &path, const TuneProfile &profile)
+{
+    std::ofstream out(path);
+    if (!out)
+    {
+        throw std::runtime_error("Cannot write tune profile: " + path);
+    }
+    out << "# RMath tuning profile\n";
+    WriteTuneProfile(out, profile);
+}
+
+// 设置当前生效的配置
+inline void ApplyTuneProfile(const TuneProfile &profile)
+{
+    auto &state = Detail::TuneState::Instance();
+    std::lock_guard lock(state.mutex);
+    state.profile = profile;
+    state.loaded = true;
+}
+
+// 当前生效的配置：首次调用时若设置了环境变量 RMATH_TUNE_PROFILE 则从该文件载入，否则使用默认值
+inline TuneProfile ActiveTuneProfile()
+{
+    auto &state = Detail::TuneState::Instance();
+    std::lock_guard lock(state.mutex);
+    if (!state.loaded)
+    {
+        state.loaded = true;
+        if (const char *path = std::getenv("RMATH_TUNE_PROFILE"))
+            state.profile = LoadTuneProfile(path);
+    }
+    return state.profile;
+}
+
+#endif // TUNE_HPP
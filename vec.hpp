@@ -2,19 +2,28 @@
 #include <list>
 #include <vector>
 #include <span>
+#include <tuple>
+#include <utility>
 #include <concepts>
 #include <iostream>
 #include <cmath>
 #include "range.hpp"
+#include "policy.hpp"
 
 #ifndef VEC_HPP
 #define VEC_HPP
 
 namespace Detail
 {
-    // 概念：Numeric 表示数值类型（整数或浮点数）
+    // 特征：IsScalarExtension 用于登记可作为 Vec/Mat 元素的自定义标量（如区间）
     template <typename T>
-    concept NumericVec = std::is_arithmetic_v<T>;
+    struct IsScalarExtension : std::false_type
+    {
+    };
+
+    // 概念：Numeric 表示数值类型（整数、浮点数或登记过的自定义标量）
+    template <typename T>
+    concept NumericVec = std::is_arithmetic_v<T> || IsScalarExtension<T>::value;
 
     // 结构体：ComplieTimeIndexCheck 用于编译期检查索引是否超出范围
     template <std::size_t Limit>
@@ -401,7 +410,7 @@ public:
             _data[0] * other._data[1] - _data[1] * other._data[0]);
     }
 
-    constexpr Vec operator-()
+    constexpr Vec operator-() const
     {
         Vec result{};
         for (size_t i = 0; i < N; ++i)
@@ -516,22 +525,26 @@ public:
 };
 
 // 模长
+template <Detail::FloatPolicy P, Detail::NumericVec T, std::size_t N>
+T Length(P, const Vec<T, N> &v)
+{
+    T sum = Detail::Reduce<P, T>(N, [&](std::size_t i)
+                                 { return v[i]; }, [&](std::size_t i)
+                                 { return v[i]; });
+    return sqrt(sum);
+}
+
 template <Detail::NumericVec T, std::size_t N>
 T Length(const Vec<T, N> &v)
 {
-    T sum = 0;
-    for (size_t i = 0; i < N; ++i)
-    {
-        sum += v[i] * v[i];
-    }
-    return sqrt(sum);
+    return Length(DefaultPolicy{}, v);
 }
 
 // 归一化
-template <Detail::NumericVec T, std::size_t N>
-Vec<T, N> Normalize(const Vec<T, N> &v)
+template <Detail::FloatPolicy P, Detail::NumericVec T, std::size_t N>
+Vec<T, N> Normalize(P policy, const Vec<T, N> &v)
 {
-    T len = Length(v);
+    T len = Length(policy, v);
     if (len > 0)
     {
         return (v) / len;
@@ -539,21 +552,44 @@ Vec<T, N> Normalize(const Vec<T, N> &v)
     return Vec<T, N>{};
 }
 
+template <Detail::NumericVec T, std::size_t N>
+Vec<T, N> Normalize(const Vec<T, N> &v)
+{
+    return Normalize(DefaultPolicy{}, v);
+}
+
 // 点积
-template <typename... Vecs>
-    requires(sizeof...(Vecs) >= 2)
-auto Dot(const Vecs &...vecs)
+template <Detail::FloatPolicy P, typename... Vecs>
+    requires(sizeof...(Vecs) >= 2) &&
+            (... && requires { typename std::remove_cvref_t<Vecs>::vec_type_alias; })
+auto Dot(P, const Vecs &...vecs)
 {
     constexpr std::size_t N = (std::tuple_element_t<0, std::tuple<Vecs...>>::size());
     static_assert(((vecs.size() == N) && ...), "All vectors must have the same dimension N");
     using ResultType = std::common_type_t<typename Vecs::vec_type_alias...>;
-    ResultType total_sum = 0;
-    for (std::size_t i = 0; i < N; ++i)
-    {
-        total_sum += (static_cast<ResultType>(vecs[i]) * ...);
-    }
 
-    return total_sum;
+    // 前 n-1 个向量的积作为乘数，最后一个向量作为被乘数
+    auto split = std::forward_as_tuple(vecs...);
+    constexpr std::size_t Last = sizeof...(Vecs) - 1;
+    return Detail::Reduce<P, ResultType>(
+        N,
+        [&](std::size_t i)
+        {
+            return [&]<std::size_t... I>(std::index_sequence<I...>)
+            {
+                return (static_cast<ResultType>(std::get<I>(split)[i]) * ...);
+            }(std::make_index_sequence<Last>{});
+        },
+        [&](std::size_t i)
+        { return static_cast<ResultType>(std::get<Last>(split)[i]); });
+}
+
+template <typename... Vecs>
+    requires(sizeof...(Vecs) >= 2) &&
+            (... && requires { typename std::remove_cvref_t<Vecs>::vec_type_alias; })
+auto Dot(const Vecs &...vecs)
+{
+    return Dot(DefaultPolicy{}, vecs...);
 }
 
 // 向量 Hadamard 积 (按元素相乘)
@@ -613,12 +649,45 @@ auto Distance(const Vec<T, N> &a, const Vec<U, N> &b)
     return std::sqrt(Dot(diff, diff));
 }
 
-// 线性插值
+// 线性插值：fma(t, b - a, a)
 template <Detail::NumericVec T, Detail::NumericVec U, std::size_t N, typename V>
 auto Lerp(const Vec<T, N> &a, const Vec<U, N> &b, V t)
 {
     using ResultT = std::common_type_t<T, U, V>;
-    return Vec<ResultT, N>(a) * (static_cast<ResultT>(1.0) - static_cast<ResultT>(t)) + Vec<ResultT, N>(b) * static_cast<ResultT>(t);
+    const auto s = static_cast<ResultT>(t);
+    Vec<ResultT, N> result;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const auto ai = static_cast<ResultT>(a[i]);
+        result[i] = Detail::MulAdd<DefaultPolicy, ResultT>(s, static_cast<ResultT>(b[i]) - ai, ai);
+    }
+    return result;
+}
+
+// 融合乘加 a * b + c（按元素）
+template <Detail::NumericVec T, Detail::NumericVec U, Detail::NumericVec V, std::size_t N>
+constexpr auto MulAdd(const Vec<T, N> &a, const Vec<U, N> &b, const Vec<V, N> &c)
+{
+    using ResultT = std::common_type_t<T, U, V>;
+    Vec<ResultT, N> result;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        result[i] = Detail::MulAdd<DefaultPolicy, ResultT>(static_cast<ResultT>(a[i]), static_cast<ResultT>(b[i]), static_cast<ResultT>(c[i]));
+    }
+    return result;
+}
+
+// 融合乘加 s * a + c（标量乘向量）
+template <Detail::NumericVec S, Detail::NumericVec U, Detail::NumericVec V, std::size_t N>
+constexpr auto MulAdd(const S &s, const Vec<U, N> &a, const Vec<V, N> &c)
+{
+    using ResultT = std::common_type_t<S, U, V>;
+    Vec<ResultT, N> result;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        result[i] = Detail::MulAdd<DefaultPolicy, ResultT>(static_cast<ResultT>(s), static_cast<ResultT>(a[i]), static_cast<ResultT>(c[i]));
+    }
+    return result;
 }
 
 // 2. 投影 Project
@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "range.hpp"
+#include "vec.hpp"
+
+#ifndef VIEWS_HPP
+#define VIEWS_HPP
+
+// 并行遍历多个范围，每一步产生 Vec<T, N>（T 为各范围元素的公共类型），长度取最短者
+template <std::ranges::view... V>
+    requires(sizeof...(V) > 0 && (std::ranges::input_range<V> && ...))
+struct ZipView final : std::ranges::view_interface<ZipView<V...>>
+{
+    using element_type = std::common_type_t<std::ranges::range_value_t<V>...>;
+    using value_type = Vec<element_type, sizeof...(V)>;
+
+private:
+    // 数据
+    std::tuple<V...> _views;
+
+public:
+    // 哨兵：任一范围到达末尾即结束；Const 为 true 时遍历 const 视图
+    template <bool Const>
+    struct Sentinel
+    {
+        std::tuple<std::ranges::sentinel_t<std::conditional_t<Const, const V, V>>...> ends;
+    };
+
+    template <bool Const>
+    struct Iterator
+    {
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = ZipView::value_type;
+        using difference_type = std::ptrdiff_t;
+
+        std::tuple<std::ranges::iterator_t<std::conditional_t<Const, const V, V>>...> its;
+
+        constexpr value_type operator*() const
+        {
+            return std::apply([](const auto &...it)
+                              { return value_type(static_cast<element_type>(*it)...); }, its);
+        }
+
+        constexpr Iterator &operator++()
+        {
+            std::apply([](auto &...it)
+                       { (++it, ...); }, its);
+            return *this;
+        }
+
+        constexpr Iterator operator++(int)
+        {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        constexpr bool operator==(const Iterator &other) const { return std::get<0>(its) == std::get<0>(other.its); }
+
+        constexpr bool operator==(const Sentinel<Const> &end) const
+        {
+            return [&]<std::size_t... I>(std::index_sequence<I...>)
+            { return ((std::get<I>(its) == std::get<I>(end.ends)) || ...); }(std::index_sequence_for<V...>{});
+        }
+    };
+
+    // 构造
+    ZipView() = default;
+
+    constexpr explicit ZipView(V... views) : _views(std::move(views)...) {}
+
+    // 迭代
+    constexpr Iterator<false> begin()
+    {
+        return Iterator<false>{std::apply([](auto &...v)
+                                          { return std::tuple(std::ranges::begin(v)...); }, _views)};
+    }
+
+    constexpr Sentinel<false> end()
+    {
+        return Sentinel<false>{std::apply([](auto &...v)
+                                          { return std::tuple(std::ranges::end(v)...); }, _views)};
+    }
+
+    constexpr Iterator<true> begin() const
+        requires(std::ranges::input_range<const V> && ...)
+    {
+        return Iterator<true>{std::apply([](const auto &...v)
+                                         { return std::tuple(std::ranges::begin(v)...); }, _views)};
+    }
+
+    constexpr Sentinel<true> end() const
+        requires(std::ranges::input_range<const V> && ...)
+    {
+        return Sentinel<true>{std::apply([](const auto &...v)
+                                         { return std::tuple(std::ranges::end(v)...); }, _views)};
+    }
+
+    // 查询方法
+    constexpr std::size_t size() const
+        requires(std::ranges::sized_range<const V> && ...)
+    {
+        return std::apply([](const auto &...v)
+                          { return std::min({static_cast<std::size_t>(std::ranges::size(v))...}); }, _views);
+    }
+};
+
+template <std::ranges::viewable_range... R>
+ZipView(R &&...) -> ZipView<std::views::all_t<R>...>;
+
+template <std::ranges::viewable_range... R>
+constexpr auto Zip(R &&...ranges)
+{
+    return ZipView<std::views::all_t<R>...>(std::views::all(std::forward<R>(ranges))...);
+}
+
+// 定宽块：lanes 中前 count 个元素有效，其余为 0
+template <typename T, std::size_t W>
+struct VecChunk final
+{
+    Vec<T, W> lanes;
+    std::size_t count = 0;
+};
+
+// 把随机访问范围切成宽度为 W 的块（例如 SIMD 宽度），末块不足 W 时补 0
+template <std::size_t W, std::ranges::view V>
+    requires(W > 0 && std::ranges::random_access_range<const V> && std::ranges::sized_range<const V>)
+struct ChunkView final : std::ranges::view_interface<ChunkView<W, V>>
+{
+    using element_type = std::ranges::range_value_t<V>;
+    using value_type = VecChunk<element_type, W>;
+
+private:
+    // 数据
+    V _base;
+
+public:
+    struct Iterator
+    {
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = ChunkView::value_type;
+        using difference_type = std::ptrdiff_t;
+
+        std::ranges::iterator_t<const V> first{};
+        std::size_t index = 0;
+        std::size_t total = 0;
+
+        constexpr value_type operator*() const
+        {
+            value_type chunk;
+            const std::size_t offset = index * W;
+            chunk.count = std::min(W, total - offset);
+            for (std::size_t k = 0; k < chunk.count; ++k)
+                chunk.lanes[k] = first[static_cast<std::ptrdiff_t>(offset + k)];
+            return chunk;
+        }
+
+        constexpr Iterator &operator++()
+        {
+            ++index;
+            return *this;
+        }
+
+        constexpr Iterator operator++(int)
+        {
+            Iterator old = *this;
+            ++index;
+            return old;
+        }
+
+        constexpr bool operator==(const Iterator &other) const { return index == other.index; }
+    };
+
+    // 构造
+    ChunkView() = default;
+
+    constexpr explicit ChunkView(V base) : _base(std::move(base)) {}
+
+    constexpr Iterator begin() const { return Iterator{std::ranges::begin(_base), 0, total()}; }
+
+    constexpr Iterator end() const { return Iterator{std::ranges::begin(_base), size(), total()}; }
+
+    // 查询方法
+    constexpr std::size_t size() const { return (total() + W - 1) / W; }
+
+private:
+    constexpr std::size_t total() const { return static_cast<std::size_t>(std::ranges::size(_base)); }
+};
+
+namespace Detail
+{
+    // Chunk<W> 的管道适配器：r | Chunk<W> 与 Chunk<W>(r) 等价
+    template <std::size_t W>
+    struct ChunkAdaptor
+    {
+        template <std::ranges::viewable_range R>
+        constexpr auto operator()(R &&range) const
+        {
+            return ChunkView<W, std::views::all_t<R>>(std::views::all(std::forward<R>(range)));
+        }
+
+        template <std::ranges::viewable_range R>
+        friend constexpr auto operator|(R &&range, const ChunkAdaptor &adaptor)
+        {
+            return adaptor(std::forward<R>(range));
+        }
+    };
+}
+
+template <std::size_t W>
+inline constexpr Detail::ChunkAdaptor<W> Chunk{};
+
+#endif // VIEWS_HPP